@@ -8,21 +8,39 @@ C_SRCS += \
 ../Sources/Driver/Driver_GPIO.c \
 ../Sources/Driver/Driver_PIT.c \
 ../Sources/Driver/Driver_PORT.c \
-../Sources/Driver/Driver_SIM.c 
+../Sources/Driver/Driver_PWM.c \
+../Sources/Driver/Driver_TPM.c \
+../Sources/Driver/Driver_SIM.c \
+../Sources/Driver/Driver_DMA.c \
+../Sources/Driver/Driver_DMAMUX.c \
+../Sources/Driver/Driver_TIMER.c \
+../Sources/Driver/Driver_TASK.c 
 
 OBJS += \
 ./Sources/Driver/Driver_ADC0.o \
 ./Sources/Driver/Driver_GPIO.o \
 ./Sources/Driver/Driver_PIT.o \
 ./Sources/Driver/Driver_PORT.o \
-./Sources/Driver/Driver_SIM.o 
+./Sources/Driver/Driver_PWM.o \
+./Sources/Driver/Driver_TPM.o \
+./Sources/Driver/Driver_SIM.o \
+./Sources/Driver/Driver_DMA.o \
+./Sources/Driver/Driver_DMAMUX.o \
+./Sources/Driver/Driver_TIMER.o \
+./Sources/Driver/Driver_TASK.o 
 
 C_DEPS += \
 ./Sources/Driver/Driver_ADC0.d \
 ./Sources/Driver/Driver_GPIO.d \
 ./Sources/Driver/Driver_PIT.d \
 ./Sources/Driver/Driver_PORT.d \
-./Sources/Driver/Driver_SIM.d 
+./Sources/Driver/Driver_PWM.d \
+./Sources/Driver/Driver_TPM.d \
+./Sources/Driver/Driver_SIM.d \
+./Sources/Driver/Driver_DMA.d \
+./Sources/Driver/Driver_DMAMUX.d \
+./Sources/Driver/Driver_TIMER.d \
+./Sources/Driver/Driver_TASK.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
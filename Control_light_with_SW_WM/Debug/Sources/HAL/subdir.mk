@@ -8,21 +8,33 @@ C_SRCS += \
 ../Sources/HAL/HAL_GPIO.c \
 ../Sources/HAL/HAL_PIT.c \
 ../Sources/HAL/HAL_PORT.c \
-../Sources/HAL/HAL_SIM.c 
+../Sources/HAL/HAL_SIM.c \
+../Sources/HAL/HAL_TPM.c \
+../Sources/HAL/HAL_DMA.c \
+../Sources/HAL/HAL_DMAMUX.c \
+../Sources/HAL/HAL_CORE.c 
 
 OBJS += \
 ./Sources/HAL/HAL_ADC0.o \
 ./Sources/HAL/HAL_GPIO.o \
 ./Sources/HAL/HAL_PIT.o \
 ./Sources/HAL/HAL_PORT.o \
-./Sources/HAL/HAL_SIM.o 
+./Sources/HAL/HAL_SIM.o \
+./Sources/HAL/HAL_TPM.o \
+./Sources/HAL/HAL_DMA.o \
+./Sources/HAL/HAL_DMAMUX.o \
+./Sources/HAL/HAL_CORE.o 
 
 C_DEPS += \
 ./Sources/HAL/HAL_ADC0.d \
 ./Sources/HAL/HAL_GPIO.d \
 ./Sources/HAL/HAL_PIT.d \
 ./Sources/HAL/HAL_PORT.d \
-./Sources/HAL/HAL_SIM.d 
+./Sources/HAL/HAL_SIM.d \
+./Sources/HAL/HAL_TPM.d \
+./Sources/HAL/HAL_DMA.d \
+./Sources/HAL/HAL_DMAMUX.d \
+./Sources/HAL/HAL_CORE.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,178 @@
+/**
+ * @file  : Driver_DMA.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum, typdef, macro and function using in Driver_DMA.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_DMA_H_
+#define _DRIVER_DMA_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define DMA_CHANNEL_COUNT (4u)          /*Number of DMA channels*/
+#define DMA_MAX_BYTE_COUNT (0xFFFFFu)   /*Highest byte count of one transfer*/
+
+/*******************************************************************************
+ * Typedef
+ ******************************************************************************/
+
+/**
+ * @brief DMA channel callback pointer.
+ */
+typedef void (*DMA_callback)(void);
+
+/*******************************************************************************
+ * Enum
+ ******************************************************************************/
+
+/**
+ * @brief Reference of the size of each data moved by the DMA.
+ */
+typedef enum DMA_size_type
+{
+    DMA_SIZE_32BIT = 0u,    /*32-bit data*/
+    DMA_SIZE_8BIT = 1u,     /*8-bit data*/
+    DMA_SIZE_16BIT = 2u,    /*16-bit data*/
+} DMA_size_enum_t;
+
+/**
+ * @brief Reference of the circular buffer size of the source address.
+ */
+typedef enum DMA_modulo_type
+{
+    DMA_MODULO_DISABLED = 0u,   /*Source address is not wrapped*/
+    DMA_MODULO_16B = 1u,        /*Source wraps in a 16 bytes buffer aligned on 16 bytes*/
+    DMA_MODULO_32B = 2u,        /*Source wraps in a 32 bytes buffer*/
+    DMA_MODULO_64B = 3u,        /*Source wraps in a 64 bytes buffer*/
+    DMA_MODULO_128B = 4u,       /*Source wraps in a 128 bytes buffer*/
+    DMA_MODULO_256B = 5u,       /*Source wraps in a 256 bytes buffer*/
+    DMA_MODULO_512B = 6u,       /*Source wraps in a 512 bytes buffer*/
+    DMA_MODULO_1KB = 7u,        /*Source wraps in a 1 KB buffer*/
+} DMA_modulo_enum_t;
+
+/**
+ * @brief Reference of the channel link.
+ */
+typedef enum DMA_link_type
+{
+    DMA_LINK_DISABLED = 0u,         /*No linked channel*/
+    DMA_LINK_EACH_TRANSFER = 2u,    /*The linked channel does one transfer after each transfer*/
+} DMA_link_enum_t;
+
+/**
+ * @brief Reference of the peripheral request state.
+ */
+typedef enum DMA_request_type
+{
+    DMA_REQUEST_DISABLED = 0u,  /*Peripheral requests are ignored*/
+    DMA_REQUEST_ENABLED = 1u,   /*Each peripheral request starts one transfer*/
+} DMA_request_enum_t;
+
+/**
+ * @brief Reference of the interrupt request state.
+ */
+typedef enum DMA_IRQ_type
+{
+    DMA_IRQ_DISABLED = 0u,  /*No interrupt at the end of the transfer*/
+    DMA_IRQ_ENABLED = 1u,   /*Interrupt when the byte count reaches 0*/
+} DMA_IRQ_enum_t;
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Information about the DMA channel configuration
+ */
+typedef struct DMA_config
+{
+    uint8_t channel;                    /*Index of the DMA channel (0 to 3)*/
+    uint32_t source_address;            /*Address of the first data to read*/
+    uint32_t destination_address;       /*Address of the first data to write*/
+    uint32_t byte_count;                /*Number of bytes to move (up to DMA_MAX_BYTE_COUNT)*/
+    DMA_size_enum_t size;               /*Size of each data*/
+    uint8_t source_increment;           /*1 if the source address moves after each data*/
+    uint8_t destination_increment;      /*1 if the destination address moves after each data*/
+    DMA_modulo_enum_t source_modulo;    /*Circular buffer size of the source*/
+    DMA_link_enum_t link;               /*Link to an other channel*/
+    uint8_t linked_channel;             /*Index of the linked channel*/
+    DMA_request_enum_t request_state;   /*Peripheral request state*/
+    DMA_IRQ_enum_t IRQ_state;           /*Interrupt request state*/
+} DMA_config_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Register the callback of a DMA channel interrupt
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param callback_func is the address of the function to callback
+ *
+ * @return: This function return nothing.
+ */
+void Driver_DMA_register_callback(uint8_t channel, DMA_callback callback_func);
+
+/**
+ * @brief Init a DMA channel, one data is moved per request (cycle steal)
+ *
+ * @param DMA_config is a struct pointer has the information about the DMA channel configuration
+ *
+ * @return 1 if the channel is configured, 0 if the configuration is rejected and the channel is not changed.
+ */
+uint8_t Driver_DMA_init(DMA_config_info *DMA_config);
+
+/**
+ * @brief Stop a DMA channel, its peripheral requests and interrupt are disabled and its flags cleared
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_DMA_stop(uint8_t channel);
+
+/**
+ * @brief Set the number of bytes left to move by a DMA channel
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param byte_count is the number of bytes (up to DMA_MAX_BYTE_COUNT)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_DMA_set_byte_count(uint8_t channel, uint32_t byte_count);
+
+/**
+ * @brief Read the source address of a DMA channel
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return the address of the next data to read.
+ */
+uint32_t Driver_DMA_read_source_address(uint8_t channel);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
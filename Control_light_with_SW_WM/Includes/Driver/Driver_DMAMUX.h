@@ -0,0 +1,96 @@
+/**
+ * @file  : Driver_DMAMUX.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum, typdef, macro and function using in Driver_DMAMUX.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_DMAMUX_H_
+#define _DRIVER_DMAMUX_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define DMAMUX_CHANNEL_COUNT (4u)   /*Number of DMAMUX channels, one per DMA channel*/
+
+/*******************************************************************************
+ * Enum
+ ******************************************************************************/
+
+/**
+ * @brief Reference of the DMA request source.
+ */
+typedef enum DMAMUX_source_type
+{
+    DMAMUX_SOURCE_DISABLED = 0u,        /*No request*/
+    DMAMUX_SOURCE_ALWAYS_ENABLED = 60u, /*Request always present, paced by the PIT trigger*/
+} DMAMUX_source_enum_t;
+
+/**
+ * @brief Reference of the PIT trigger state.
+ */
+typedef enum DMAMUX_trigger_type
+{
+    DMAMUX_TRIGGER_DISABLED = 0u,   /*The request is passed as soon as it is present*/
+    DMAMUX_TRIGGER_ENABLED = 1u,    /*The request is passed once per timeout of PIT timer n*/
+} DMAMUX_trigger_enum_t;
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Information about the DMAMUX channel configuration
+ */
+typedef struct DMAMUX_config
+{
+    uint8_t channel;                /*Index of the DMAMUX channel (0 to 3), PIT timer n triggers channel n*/
+    DMAMUX_source_enum_t source;    /*Request source*/
+    DMAMUX_trigger_enum_t trigger;  /*PIT trigger state, only channels 0 and 1 have a PIT timer*/
+} DMAMUX_config_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Route a request source to a DMA channel
+ *
+ * @param DMAMUX_config is a struct pointer has the information about the DMAMUX channel configuration
+ *
+ * @return: This function return nothing.
+ */
+void Driver_DMAMUX_init(DMAMUX_config_info *DMAMUX_config);
+
+/**
+ * @brief Stop the requests to a DMA channel
+ *
+ * @param channel is the index of the DMAMUX channel (0 to 3)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_DMAMUX_disable(uint8_t channel);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -110,6 +110,44 @@ uint8_t Driver_GPIO_read_pin_state(Port_type_enum_t port_type, uint8_t pin);
  */
 void Driver_GPIO_toggle_pin_state(Port_type_enum_t port_type, uint8_t pin);
 
+/**
+ * @brief Set several pins of a PORT to high state in one write
+ *
+ * @param port_type is the PORT which contains the pins.
+ * @param pin_mask has bit n set for each pin n to set.
+ *
+ * @return: this function return nothing.
+ */
+void Driver_GPIO_set_port_pins(Port_type_enum_t port_type, uint32_t pin_mask);
+
+/**
+ * @brief Clear several pins of a PORT to low state in one write
+ *
+ * @param port_type is the PORT which contains the pins.
+ * @param pin_mask has bit n set for each pin n to clear.
+ *
+ * @return: this function return nothing.
+ */
+void Driver_GPIO_clear_port_pins(Port_type_enum_t port_type, uint32_t pin_mask);
+
+/**
+ * @brief Get the address of the register which sets the pins of a PORT
+ *
+ * @param port_type is the PORT.
+ *
+ * @return the address of the PSOR register, 0 if the PORT is invalid.
+ */
+uint32_t Driver_GPIO_get_set_register_address(Port_type_enum_t port_type);
+
+/**
+ * @brief Get the address of the register which clears the pins of a PORT
+ *
+ * @param port_type is the PORT.
+ *
+ * @return the address of the PCOR register, 0 if the PORT is invalid.
+ */
+uint32_t Driver_GPIO_get_clear_register_address(Port_type_enum_t port_type);
+
 /*Header Guard*/
 #endif
 /*EOF*/
@@ -0,0 +1,91 @@
+/**
+ * @file  : Driver_GPIO_inline.h
+ * @author: Nguyen The Anh.
+ * @brief : Define the inline GPIO writes used in interrupt handlers.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_GPIO_inline.h"
+#include "../Includes/Driver/Driver_GPIO.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_GPIO_INLINE_H_
+#define _DRIVER_GPIO_INLINE_H_
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*
+ * Unchecked variants of the Driver_GPIO writes for the interrupt hot path. The
+ * port and pin must have been checked when the caller was configured.
+ */
+
+/**
+ * @brief Set the pins of a PORT given by a mask
+ *
+ * @param port_type is the type of the PORT (PORT_A to PORT_E), it is not checked
+ * @param pin_mask has bit n set for each pin n to set
+ *
+ * @return: This function return nothing.
+ */
+static inline void Driver_GPIO_set_port_pins_fast(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    HAL_FGPIO_set_PORT_fast(HAL_FGPIO_get_port_fast((uint8_t)port_type), pin_mask);
+
+    return;
+}
+
+/**
+ * @brief Clear the pins of a PORT given by a mask
+ *
+ * @param port_type is the type of the PORT (PORT_A to PORT_E), it is not checked
+ * @param pin_mask has bit n set for each pin n to clear
+ *
+ * @return: This function return nothing.
+ */
+static inline void Driver_GPIO_clear_port_pins_fast(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    HAL_FGPIO_clear_PORT_fast(HAL_FGPIO_get_port_fast((uint8_t)port_type), pin_mask);
+
+    return;
+}
+
+/**
+ * @brief Write a state to a pin
+ *
+ * @param port_type is the type of the PORT (PORT_A to PORT_E), it is not checked
+ * @param pin is the pin number (0 to 31), it is not checked
+ * @param state is the state to write
+ *
+ * @return: This function return nothing.
+ */
+static inline void Driver_GPIO_set_pin_State_fast(Port_type_enum_t port_type, uint8_t pin, Pin_state_enum_t state)
+{
+    if (HIGH_STATE == state)
+    {
+        HAL_FGPIO_set_PORT_fast(HAL_FGPIO_get_port_fast((uint8_t)port_type), 1u << pin);
+    }
+    else
+    {
+        HAL_FGPIO_clear_PORT_fast(HAL_FGPIO_get_port_fast((uint8_t)port_type), 1u << pin);
+    }
+
+    return;
+}
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
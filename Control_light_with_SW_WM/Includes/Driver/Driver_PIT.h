@@ -21,14 +21,21 @@
 #ifndef _DRIVER_PIT_H_
 #define _DRIVER_PIT_H_
 
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+/*Load value of the interval closest to a frequency, for constant initializers; both arguments in Hz*/
+#define PIT_LOAD_VALUE(bus_clock, frequency) ((((bus_clock) + ((frequency) / 2u)) / (frequency)) - 1u)
+
 /*******************************************************************************
  * Typedef
  ******************************************************************************/
 
 /**
- * @brief function callback pointer.
+ * @brief function callback pointer, context is the pointer registered with the callback.
  */
-typedef void (*callback)(void);
+typedef void (*callback)(void *context);
 
 /*******************************************************************************
  * Enum
@@ -103,6 +110,28 @@ typedef struct TCTRL_config
     TCTRL_CHN_type_enum_t chain_mode;   /*Timer chain mode state*/
 } TCTRL_config_info;
 
+/**
+ * @brief Information about the callback of a timer
+ */
+typedef struct PIT_callback
+{
+    callback callback_func;             /*Function called when the timer interrupts*/
+    void *context;                      /*Pointer passed to the function*/
+} PIT_callback_info;
+
+/**
+ * @brief Load values of a timer for a frequency and their error
+ */
+typedef struct PIT_rate
+{
+    uint32_t load_value;                /*Load value of the whole interval closest to the frequency*/
+    uint32_t achieved_frequency;        /*Frequency of load_value in Hz, rounded*/
+    int32_t error_ppm;                  /*Error of the achieved frequency in parts per million, rounded*/
+    uint32_t fractional_load_value;     /*Whole part of the fractional load value*/
+    uint16_t fraction;                  /*Fractional part of the fractional load value, in 1/65536 of a count*/
+    int32_t fractional_error_ppb;       /*Error of the average frequency of the fractional load value in ppb*/
+} PIT_rate_info;
+
 /**
  * @brief Information about the PIT configuration
  */
@@ -122,13 +151,18 @@ typedef struct PIT_config
  ******************************************************************************/
 
 /**
- * @brief Register a callback function
+ * @brief Register the callback function of a timer
+ *
+ * Each timer has its own entry, the interrupt handler calls the entry of every timer whose flag is set.
+ * Register a callback with a new context while the interrupt of the timer is disabled.
  *
- * @param callback_func is the address of the function to callback
+ * @param timer_index is the index of the timer (0 / 1)
+ * @param callback_func is the address of the function to callback when timer n interrupts, NULL removes it
+ * @param context is passed to the function at each call
  *
  * @return: This function return nothing.
  */
-void Driver_PIT_register_callabck(callback callback_func);
+void Driver_PIT_register_callabck(uint8_t timer_index, callback callback_func, void *context);
 
 /**
  * @brief Init the PIT
@@ -139,6 +173,62 @@ void Driver_PIT_register_callabck(callback callback_func);
  */
 void Driver_PIT_init(PIT_config_info *PIT_config);
 
+/**
+ * @brief Stop timer n and give it back
+ *
+ * The interrupt, chain mode and callback of the timer are removed. Once both timers are released, or were never
+ * initialized, the lifetime timer can start.
+ *
+ * @param timer_index is the index of the timer (0 / 1)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PIT_release_timer(uint8_t timer_index);
+
+/**
+ * @brief Start the 64-bit lifetime timer on the chained timers 0 and 1
+ *
+ * Both timers count the bus clock without interrupt, about 55,000 years at the 10.49 MHz bus clock before the
+ * value wraps. It needs both timers: it is not started while a timer initialized by Driver_PIT_init (a PWM group
+ * of the PIT engine, the prescaler of a chained PWM period or the software timers) is not released. Once it
+ * runs, Driver_PIT_init, Driver_PIT_set_load_value and Driver_PIT_select_Timer_state are ignored, so a PWM group
+ * can only run channels on a TPM. The bus clock is read once here for Driver_PIT_counts_to_us/ns.
+ *
+ * @param: This function has no parameter.
+ *
+ * @return 1 if the lifetime timer runs (started now or before), 0 if a timer is in use.
+ */
+uint8_t Driver_PIT_start_lifetime_timer(void);
+
+/**
+ * @brief Read the number of bus clock cycles since the lifetime timer was started
+ *
+ * Both words are taken from the same instant, it can be called from any interrupt.
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the number of bus clock cycles, 0 if the lifetime timer is not started.
+ */
+uint64_t Driver_PIT_read_lifetime(void);
+
+/**
+ * @brief Convert a number of bus clock cycles to microseconds
+ *
+ * @param counts is the number of bus clock cycles, e.g. the difference of two lifetime timer values
+ *
+ * @return the time in microseconds at the bus clock of the lifetime timer, rounded down, 0 if it is not started.
+ */
+uint64_t Driver_PIT_counts_to_us(uint64_t counts);
+
+/**
+ * @brief Convert a number of bus clock cycles to nanoseconds
+ *
+ * @param counts is the number of bus clock cycles, e.g. the difference of two lifetime timer values
+ *
+ * @return the time in nanoseconds at the bus clock of the lifetime timer, rounded down, 0 if it is not started.
+ */
+uint64_t Driver_PIT_counts_to_ns(uint64_t counts);
+
 /**
  * @brief Configure the MCR register
  *
@@ -176,6 +266,57 @@ void Driver_PIT_select_module_state(MCR_MDIS_type_enum_t module_state);
  */
 void Driver_PIT_set_load_value(uint8_t timer_index, uint32_t load_value);
 
+/**
+ * @brief Read the current value of timer n
+ *
+ * @param timer_index is the index of the timer (0/1)
+ *
+ * @return the current value of timer n, it counts down to 0 from the load value.
+ */
+uint32_t Driver_PIT_read_current_value(uint8_t timer_index);
+
+/**
+ * @brief Set a load value with a fractional part for timer n
+ *
+ * The timer alternates between load_value and load_value + 1, so that the
+ * average interval is (load_value + 1 + fraction / 65536) counts.
+ *
+ * @param timer_index is the index of the timer (0/1)
+ * @param load_value is the whole part of the value to load to the timer n.
+ * @param fraction is the fractional part of the value, in 1/65536 of a count.
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PIT_set_fractional_load_value(uint8_t timer_index, uint32_t load_value, uint16_t fraction);
+
+/**
+ * @brief Write the load value of the next interval of a fractional load value
+ *
+ * It must be called once per timeout of timer n, from its interrupt. The offset changes the length of the next
+ * interval only, the average of the following ones is kept.
+ *
+ * @param timer_index is the index of the timer (0/1)
+ * @param offset is the number of counts added to the next interval, it keeps the interval above 0
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PIT_update_fractional_load(uint8_t timer_index, int32_t offset);
+
+/**
+ * @brief Compute the load values of a timer closest to a frequency
+ *
+ * load_value is the whole interval for a single Driver_PIT_set_load_value. fractional_load_value and fraction
+ * are the arguments of Driver_PIT_set_fractional_load_value, their average interval is within 1/131072 count of
+ * the exact one. The errors are positive when the timer runs faster than the target.
+ *
+ * @param frequency is the target timeout frequency in Hz (1 to bus_clock)
+ * @param bus_clock is the clock of the PIT timers in Hz, e.g. Driver_SIM_get_bus_clock()
+ * @param rate is the address to store the load values and their errors
+ *
+ * @return 1 if rate is written, 0 if an input is out of range.
+ */
+uint8_t Driver_PIT_calculate_rate(uint32_t frequency, uint32_t bus_clock, PIT_rate_info *rate);
+
 /**
  * @brief Configure the TCTRLn register
  *
@@ -224,6 +365,26 @@ void Driver_PIT_select_Chain_Mode(uint8_t timer_index, TCTRL_CHN_type_enum_t cha
  */
 void Driver_PIT_set_IRQ_flag(uint8_t timer_index);
 
+/**
+ * @brief Read the interrupt flag of timer n
+ *
+ * @param timer_index is the index of the timer (0/1)
+ *
+ * @return 1 if timer n timed out and its flag is not cleared yet, 0 otherwise.
+ */
+uint8_t Driver_PIT_read_IRQ_flag(uint8_t timer_index);
+
+/**
+ * @brief Enable or mask the PIT interrupt handler of both timers in the NVIC
+ *
+ * A flag set while the handler is masked is serviced once it is enabled again.
+ *
+ * @param handler_state is the state of the PIT interrupt handler (enabled/disabled).
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PIT_select_IRQ_handler_state(TCTRL_TIE_type_enum_t handler_state);
+
 /*******************************************************************************
  * End of header guard
  ******************************************************************************/
@@ -0,0 +1,64 @@
+/**
+ * @file  : Driver_PIT_inline.h
+ * @author: Nguyen The Anh.
+ * @brief : Define the inline PIT accesses used in interrupt handlers.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_PIT_inline.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_PIT_INLINE_H_
+#define _DRIVER_PIT_INLINE_H_
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*
+ * Unchecked variants of the Driver_PIT accesses for the interrupt of a timer
+ * the caller has initialized. They do not look at the lifetime timer.
+ */
+
+/**
+ * @brief Set load value for timer n, it is used at the next timeout
+ *
+ * @param timer_index is the index of the timer (0/1), it is not checked
+ * @param load_value is the value to load to the timer n.
+ *
+ * @return: This function return nothing.
+ */
+static inline void Driver_PIT_set_load_value_fast(uint8_t timer_index, uint32_t load_value)
+{
+    HAL_PIT_LDVALn_set_TSV_fast(timer_index, load_value);
+
+    return;
+}
+
+/**
+ * @brief Read the current value of timer n
+ *
+ * @param timer_index is the index of the timer (0/1), it is not checked
+ *
+ * @return the current value of timer n, it counts down to 0 from the load value.
+ */
+static inline uint32_t Driver_PIT_read_current_value_fast(uint8_t timer_index)
+{
+    return HAL_PIT_CVALn_read_TVL_fast(timer_index);
+}
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
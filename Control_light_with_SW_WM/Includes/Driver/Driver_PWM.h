@@ -0,0 +1,435 @@
+/**
+ * @file  : Driver_PWM.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum, typdef, macro and function using in Driver_PWM.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "../Includes/Driver/Driver_GPIO.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_PWM_H_
+#define _DRIVER_PWM_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define PWM_MAX_CHANNELS (8u)       /*Number of output channels of the PWM engine*/
+#define PWM_PORT_COUNT (5u)         /*Number of GPIO ports (PORTA to PORTE)*/
+#define PWM_GROUP_COUNT (2u)        /*Number of PWM groups, one per PIT timer*/
+#define PWM_MIN_EDGE_COUNTS (64u)   /*Shortest time between two edges the edge ISR can keep up with*/
+#define PWM_BAM_MAX_BITS (12u)      /*Highest bit-angle modulation resolution in bits*/
+#define PWM_MAX_DITHER_BITS (16u)   /*Highest number of sigma-delta sub-step bits*/
+#define PWM_DMA_MIN_STEPS (16u)     /*Lowest resolution of the DMA mode*/
+#define PWM_DMA_MAX_STEPS (256u)    /*Highest resolution of the DMA mode, size of its pattern buffers*/
+#define PWM_DMA_MIN_TICK_COUNTS (32u)   /*Shortest duty step the DMA can move two words in*/
+#define PWM_MAX_SPREAD_PERMILLE (100u)  /*Highest period spread, in thousandths of the period*/
+#define PWM_MAX_DEAD_COUNTS (PWM_MIN_EDGE_COUNTS / 2u)  /*Longest dead time, the interrupt waits it*/
+#define PWM_SPREAD_STEPS (32u)      /*Periods from the shortest to the longest of the triangle spread*/
+#define PWM_TICK_TABLE_MAX_ENTRIES (PWM_DMA_MAX_STEPS)  /*Duty steps times ports of the tick mode output table*/
+#define PWM_FADE_EXP_OCTAVES (8u)   /*The exponential fade doubles the duty change 8 times (256:1 brightness range)*/
+#define PWM_MAX_STEP_COUNTS (0xFFFFu)   /*Longest duty step of the edge and BAM mode in PIT counts*/
+#define PWM_CHAIN_TIMER (1u)        /*PIT timer of a chained timebase group, PIT0 is its prescaler*/
+
+/*******************************************************************************
+ * Enum
+ ******************************************************************************/
+
+/**
+ * @brief Reference of the software PWM mode.
+ */
+typedef enum PWM_mode_type
+{
+    PWM_TICK_MODE = 0u, /*PIT interrupts once per duty step and counts ticks*/
+    PWM_EDGE_MODE = 1u, /*PIT is reloaded with the time to the next edge*/
+    PWM_BAM_MODE = 2u,  /*Bit-angle modulation, PIT interrupts once per duty bit*/
+    PWM_DMA_MODE = 3u,  /*PIT triggers a DMA which streams one period of port masks, no interrupt*/
+} PWM_mode_type_enum_t;
+
+/**
+ * @brief Reference of where the PWM output pins are written.
+ */
+typedef enum PWM_output_type
+{
+    PWM_OUTPUT_FOREGROUND = 0u, /*Pins are written by Driver_PWM_update_output from the main loop*/
+    PWM_OUTPUT_ISR = 1u,        /*Pins are written inside the PIT interrupt*/
+} PWM_output_type_enum_t;
+
+/**
+ * @brief Reference of where the pulse of each channel starts in the period.
+ */
+typedef enum PWM_phase_type
+{
+    PWM_PHASE_ALIGNED = 0u,     /*Every pulse starts at the period start*/
+    PWM_PHASE_SPREAD = 1u,      /*Pulse starts are spread evenly over the period*/
+    PWM_PHASE_EXPLICIT = 2u,    /*Pulse start is the phase of the channel configuration*/
+} PWM_phase_enum_t;
+
+/**
+ * @brief Reference of where the pulse of a channel sits around its phase.
+ */
+typedef enum PWM_align_type
+{
+    PWM_ALIGN_EDGE = 0u,    /*Pulse turns on at the phase of the channel*/
+    PWM_ALIGN_CENTER = 1u,  /*Pulse is centered half a period after the phase of the channel*/
+} PWM_align_enum_t;
+
+/**
+ * @brief Reference of the role of a channel in a complementary pair.
+ */
+typedef enum PWM_pair_type
+{
+    PWM_PAIR_NONE = 0u,     /*Channel has its own duty*/
+    PWM_PAIR_LOW_SIDE = 1u, /*Channel is the complement of the channel before it, with dead time*/
+} PWM_pair_enum_t;
+
+/**
+ * @brief Reference of the unit of the dead time.
+ */
+typedef enum PWM_dead_time_unit_type
+{
+    PWM_DEAD_TIME_COUNTS = 0u,  /*Dead time in PIT counts*/
+    PWM_DEAD_TIME_NS = 1u,      /*Dead time in nanoseconds, rounded up to PIT counts*/
+} PWM_dead_time_unit_enum_t;
+
+/**
+ * @brief Reference of how the output channels are driven.
+ */
+typedef enum PWM_backend_type
+{
+    PWM_BACKEND_AUTO = 0u,      /*Pins with a TPM channel use hardware PWM, the others the PIT engine*/
+    PWM_BACKEND_SOFTWARE = 1u,  /*Every channel uses the PIT engine*/
+} PWM_backend_enum_t;
+
+/**
+ * @brief Reference of how the period length changes from one period to the next.
+ */
+typedef enum PWM_spread_type
+{
+    PWM_SPREAD_OFF = 0u,        /*Every period has the same length*/
+    PWM_SPREAD_TRIANGLE = 1u,   /*Period length sweeps up and down over 2 * PWM_SPREAD_STEPS periods*/
+    PWM_SPREAD_RANDOM = 2u,     /*Period length is pseudo-random, its sum stays close to the fixed periods*/
+} PWM_spread_enum_t;
+
+/**
+ * @brief Reference of the length of the duty steps in tick mode.
+ */
+typedef enum PWM_tick_resolution_type
+{
+    PWM_TICK_WHOLE = 0u,        /*Every step is period / resolution counts, the remainder is dropped*/
+    PWM_TICK_FRACTIONAL = 1u,   /*Steps alternate between two lengths, the period is exact*/
+    PWM_TICK_REFINED = 2u,      /*Fractional steps, the sub-step bits of a duty move its pulse end by PIT counts*/
+} PWM_tick_resolution_enum_t;
+
+/**
+ * @brief Reference of how the tick interrupt finds the pins to write.
+ */
+typedef enum PWM_tick_output_type
+{
+    PWM_TICK_COMPARE = 0u,      /*Every channel compares the tick with its pulse*/
+    PWM_TICK_TABLE = 1u,        /*Set and clear masks of every port are read from a table, rebuilt on duty changes*/
+} PWM_tick_output_enum_t;
+
+/**
+ * @brief Reference of the easing curve of a fade.
+ */
+typedef enum PWM_fade_curve_type
+{
+    PWM_FADE_LINEAR = 0u,       /*The duty changes by the same amount every period*/
+    PWM_FADE_EXPONENTIAL = 1u,  /*The duty changes by the same ratio every period, even steps for the eye*/
+    PWM_FADE_S_CURVE = 2u,      /*The duty starts and ends slowly (smoothstep)*/
+} PWM_fade_curve_enum_t;
+
+/**
+ * @brief Reference of what the PIT timer of a group counts.
+ */
+typedef enum PWM_timebase_type
+{
+    PWM_TIMEBASE_BUS = 0u,      /*PIT counts bus clock cycles*/
+    PWM_TIMEBASE_CHAINED = 1u,  /*PIT1 counts the timeouts of PIT0, one count is chain_prescaler bus clock cycles*/
+} PWM_timebase_enum_t;
+
+/**
+ * @brief Reference of the result of a PWM timing request.
+ */
+typedef enum PWM_status_type
+{
+    PWM_STATUS_OK = 0u,         /*Timing accepted*/
+    PWM_STATUS_INVALID = 1u,    /*Frequency or resolution out of range*/
+    PWM_STATUS_ISR_BUDGET = 2u, /*Interrupts would be closer than PWM_MIN_EDGE_COUNTS*/
+} PWM_status_enum_t;
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Information about one PWM output channel
+ */
+typedef struct PWM_channel_config
+{
+    Port_type_enum_t port_type; /*PORT which contains the output pin*/
+    uint8_t pin;                /*Output pin number, it must be initialized as GPIO output*/
+    Pin_state_enum_t active_state;  /*Pin state while the PWM pulse is on high logic level*/
+    uint32_t phase;             /*PWM_PHASE_EXPLICIT: pulse start in duty steps after the period start*/
+    PWM_align_enum_t alignment; /*Edge or center aligned pulse, not used in BAM mode, center is never on a TPM*/
+    PWM_pair_enum_t pair;       /*Low side of the channel before it, never on a TPM, not used in DMA mode*/
+} PWM_channel_config_info;
+
+/**
+ * @brief Information about the software PWM configuration
+ */
+typedef struct PWM_config
+{
+    PWM_mode_type_enum_t mode;  /*Software PWM mode*/
+    uint8_t timer_index;        /*Index of the PIT timer used as timebase (0 / 1)*/
+    PWM_timebase_enum_t timebase;   /*Chained only in edge and BAM mode on PWM_CHAIN_TIMER, without pair*/
+    uint32_t chain_prescaler;   /*Chained timebase: bus clock cycles per PIT count*/
+    uint32_t period_counts;     /*PWM period in PIT counts (bus clock cycles, or chain_prescaler cycles if chained)*/
+    uint32_t resolution;        /*Number of duty steps per PWM period, (2^N - 1) in BAM mode, 2^N in DMA mode*/
+    uint8_t dither_bits;        /*Sub-step bits of the duty, 0 disables sigma-delta dithering (always 0 in DMA mode)*/
+    PWM_tick_resolution_enum_t tick_resolution; /*Length of the duty steps, only used in tick mode*/
+    PWM_tick_output_enum_t tick_output;         /*Only used in tick mode with PWM_OUTPUT_ISR, no pair with the table*/
+    PWM_output_type_enum_t output_stage;    /*Where the output pins are written, not used in DMA mode*/
+    PWM_phase_enum_t phase_mode;            /*Where the pulses start, not used in BAM mode*/
+    PWM_backend_enum_t backend;             /*Hardware or software PWM for the channels*/
+    PWM_spread_enum_t spread_mode;          /*Period spread, only used in edge and BAM mode*/
+    uint16_t spread_permille;   /*Highest period change in thousandths of the period (up to PWM_MAX_SPREAD_PERMILLE)*/
+    uint32_t dead_time;         /*Time between the turn off and the turn on of a pair (up to PWM_MAX_DEAD_COUNTS)*/
+    PWM_dead_time_unit_enum_t dead_time_unit;   /*Unit of dead_time*/
+    uint8_t channel_count;      /*Number of output channels (1 to PWM_MAX_CHANNELS)*/
+    PWM_channel_config_info *channels;      /*Array of channel_count output channels*/
+} PWM_config_info;
+
+#ifdef PWM_JITTER_MEASUREMENT
+/**
+ * @brief Delay from a PWM edge to the write of the output pins, in PIT counts
+ */
+typedef struct PWM_jitter
+{
+    uint32_t min_counts;        /*Shortest delay measured*/
+    uint32_t max_counts;        /*Longest delay measured*/
+    uint32_t samples;           /*Number of edges measured*/
+} PWM_jitter_info;
+#endif
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Init the PWM channels, start the TPM modules and the PIT timer they need
+ *
+ * Each PIT timer runs its own PWM group, with its own channels, mode and
+ * period. Init sets up the group of PWM_config->timer_index and leaves the
+ * other group running. The two groups must not share a pin or a TPM module.
+ *
+ * With PWM_BACKEND_AUTO, a channel whose pin has a TPM channel is muxed to it
+ * and runs as hardware PWM at the same period. The PIT timer is only started
+ * when some channels are left to the software engine.
+ *
+ * In PWM_DMA_MODE the PIT does not interrupt: it triggers the DMA channel of
+ * the same index (0 / 1), which writes one set mask per duty step to the PSOR
+ * of the port and DMA channel 2 + timer_index the clear mask to its PCOR. Every
+ * channel must be on the same port.
+ *
+ * A PWM_PAIR_LOW_SIDE channel is on while the channel before it is off. Both
+ * switch at the same edges: the pins turning off are written first, then the
+ * interrupt waits the dead time before it writes the pins turning on.
+ *
+ * With PWM_TIMEBASE_CHAINED, PIT0 divides the bus clock by chain_prescaler
+ * and PIT1 counts its timeouts, so the period can last minutes with fine duty
+ * steps. The edge interrupt still only runs at the edges. PIT0 must not run
+ * a PWM group of its own.
+ *
+ * With a spread mode, the longest interval of each period of the PIT engine is
+ * stretched or shortened, by up to spread_permille of the period. The changes
+ * average out, so the average duty is the same as without spread.
+ *
+ * With PWM_TICK_REFINED, the dither_bits of a duty move the end of its pulse
+ * by PIT counts instead of adding whole steps in some periods, the fraction of
+ * a count alternates the step between LDVAL and LDVAL + 1. It needs
+ * PWM_PHASE_ALIGNED edge aligned pulses, and steps of at least twice
+ * PWM_MIN_EDGE_COUNTS, shorter ones are dithered by whole steps.
+ *
+ * @param PWM_config is a struct pointer has the information about the PWM configuration
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_init(PWM_config_info *PWM_config);
+
+/**
+ * @brief Compute the period of a PWM configuration from the bus clock
+ *
+ * @param PWM_config is the configuration to update, its mode and dither_bits are used for the checks
+ * @param frequency is the target PWM frequency in Hz
+ * @param resolution is the number of duty steps per period
+ * @param achieved_frequency is the address to store the PWM frequency really obtained, it may be NULL
+ *
+ * @return PWM_STATUS_OK if the period_counts and resolution of the configuration were updated.
+ */
+PWM_status_enum_t Driver_PWM_config_frequency(PWM_config_info *PWM_config, uint32_t frequency,
+                                              uint32_t resolution, uint32_t *achieved_frequency);
+
+/**
+ * @brief Compute a chained timebase and the period of a PWM configuration longer than the PIT range
+ *
+ * The prescaler is the smallest one which keeps a duty step within
+ * PWM_MAX_STEP_COUNTS, so the duty keeps the finest timing.
+ *
+ * @param PWM_config is the configuration to update, its mode and dither_bits are used for the checks
+ * @param period_ms is the PWM period in milliseconds
+ * @param resolution is the number of duty steps per period
+ *
+ * @return PWM_STATUS_OK if the timebase, chain_prescaler, period_counts and resolution were updated.
+ */
+PWM_status_enum_t Driver_PWM_config_long_period(PWM_config_info *PWM_config, uint32_t period_ms, uint32_t resolution);
+
+/**
+ * @brief Change the frequency and resolution of the running PWM from the next period
+ *
+ * The duty of every channel is rescaled to the new resolution. In DMA mode the
+ * resolution can not change and the new period starts at the next duty step.
+ * A chained timebase group keeps its period until it is initialized again.
+ * The other PWM group is not disturbed.
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param frequency is the target PWM frequency in Hz
+ * @param resolution is the number of duty steps per period
+ * @param achieved_frequency is the address to store the PWM frequency really obtained, it may be NULL
+ *
+ * @return PWM_STATUS_OK if the new timing is applied.
+ */
+PWM_status_enum_t Driver_PWM_set_frequency(uint8_t timer_index, uint32_t frequency, uint32_t resolution,
+                                           uint32_t *achieved_frequency);
+
+/**
+ * @brief Set the duty cycle of a channel, it is applied from the next PWM period
+ *
+ * The duty is written to a shadow register, the PIT interrupt latches it at the
+ * start of a period so a period never mixes two duties.
+ *
+ * With dither_bits = D, the duty has D more bits than the resolution. Each period
+ * outputs a whole number of steps and the remainder is carried to the next
+ * periods, so the average on time keeps the sub-step part.
+ *
+ * In DMA mode only the pattern marks of the channel are moved, the new duty
+ * starts at once. The duty of a PWM_PAIR_LOW_SIDE channel follows its high
+ * side and is not set.
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param channel is the index of the channel in the configuration of the group
+ * @param duty is the on time in duty steps (0 to resolution << dither_bits)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_set_duty(uint8_t timer_index, uint8_t channel, uint32_t duty);
+
+/**
+ * @brief Fade the duty cycle of a channel to a new duty over a duration
+ *
+ * The PIT interrupt moves the duty once per PWM period, from the duty the
+ * channel outputs when the request is latched, along the easing curve. The
+ * same request written again does not restart the fade, a new one starts from
+ * where the running fade is. Driver_PWM_set_duty stops the fade.
+ *
+ * A hardware channel or a DMA mode channel has no period interrupt, its duty
+ * is set at once.
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param channel is the index of the channel in the configuration of the group
+ * @param duty is the duty at the end of the fade (0 to resolution << dither_bits)
+ * @param duration_ms is the length of the fade in milliseconds
+ * @param curve is the easing curve of the fade
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_fade(uint8_t timer_index, uint8_t channel, uint32_t duty, uint32_t duration_ms,
+                     PWM_fade_curve_enum_t curve);
+
+/**
+ * @brief Check if the duty of a channel is still moving to the last duty written
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param channel is the index of the channel in the configuration of the group
+ *
+ * @return 1 if a fade or a duty update is not finished, 0 otherwise.
+ */
+uint8_t Driver_PWM_is_fading(uint8_t timer_index, uint8_t channel);
+
+/**
+ * @brief Start a batch of duty updates, they are held back until Driver_PWM_end_update
+ *
+ * Interrupts stay enabled: a period starting during the batch keeps the
+ * previous duties of every channel of the group.
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_begin_update(uint8_t timer_index);
+
+/**
+ * @brief End a batch of duty updates, all of them are output from the same PWM period
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_end_update(uint8_t timer_index);
+
+/**
+ * @brief Read the current logic level of the PWM pulse of a channel
+ *
+ * A hardware channel is read from its TPM counter, a DMA mode channel from the
+ * duty step the DMA is in.
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param channel is the index of the channel in the configuration of the group
+ *
+ * @return 1 if the PWM pulse is on high logic level, 0 otherwise.
+ */
+uint8_t Driver_PWM_read_level(uint8_t timer_index, uint8_t channel);
+
+/**
+ * @brief Write the current PWM levels to the output pins, used by the foreground output stage
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_update_output(uint8_t timer_index);
+
+#ifdef PWM_JITTER_MEASUREMENT
+/**
+ * @brief Read the edge to pin write delay measured since the last read, then restart the measurement
+ *
+ * @param timer_index is the PIT timer of the PWM group (0 / 1)
+ * @param jitter is a struct pointer to store the measurement
+ *
+ * @return: This function return nothing.
+ */
+void Driver_PWM_read_jitter(uint8_t timer_index, PWM_jitter_info *jitter);
+#endif
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
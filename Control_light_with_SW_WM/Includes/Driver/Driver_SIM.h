@@ -35,6 +35,17 @@ typedef enum clock_gate_state
     ENABLED = 1u,   /*Clock gate is enabled*/
 } clock_gate_state_enum_t;
 
+/**
+ * @brief Reference the clock source of the TPM modules.
+ */
+typedef enum TPM_clock_source
+{
+    TPM_CLOCK_DISABLED = 0u,    /*TPM counter clock is disabled*/
+    TPM_CLOCK_MCGFLLCLK = 1u,   /*MCGFLLCLK, or MCGPLLCLK/2 when the PLL is selected*/
+    TPM_CLOCK_OSCERCLK = 2u,    /*External oscillator clock*/
+    TPM_CLOCK_MCGIRCLK = 3u,    /*Internal reference clock*/
+} TPM_clock_source_enum_t;
+
 /*******************************************************************************
  * Struct
  ******************************************************************************/
@@ -86,6 +97,54 @@ void Driver_SIM_SCGC5_init_clock(SCGC5_config_info *SCGC5_clock_config);
  */
 void Driver_SIM_SCGC6_init_clock(SCGC6_config_info *SCGC6_clock_config);
 
+/**
+ * @brief Get the bus clock frequency, it is the clock of the PIT and ADC0 modules.
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the bus clock frequency in Hz, computed from SystemCoreClock and OUTDIV4.
+ */
+uint32_t Driver_SIM_get_bus_clock(void);
+
+/**
+ * @brief Set the clock gate of a TPM module.
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2).
+ * @param gate_state is the state of the clock gate.
+ *
+ * @return: This function return nothing.
+ */
+void Driver_SIM_set_TPM_clock(uint8_t TPM_index, clock_gate_state_enum_t gate_state);
+
+/**
+ * @brief Set the clock gates of the DMA controller and of the DMAMUX.
+ *
+ * @param gate_state is the state of both clock gates.
+ *
+ * @return: This function return nothing.
+ */
+void Driver_SIM_set_DMA_clock(clock_gate_state_enum_t gate_state);
+
+/**
+ * @brief Select the clock source shared by the TPM modules.
+ *
+ * @param clock_source is the TPM clock source.
+ *
+ * @return: This function return nothing.
+ */
+void Driver_SIM_select_TPM_clock_source(TPM_clock_source_enum_t clock_source);
+
+/**
+ * @brief Get the frequency of the TPM_CLOCK_MCGFLLCLK source.
+ *
+ * The MCG output is assumed to be the FLL or the PLL (FEI, FEE or PEE mode).
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the TPM clock frequency in Hz.
+ */
+uint32_t Driver_SIM_get_TPM_clock(void);
+
 /*******************************************************************************
  * End of header guard
  ******************************************************************************/
@@ -0,0 +1,114 @@
+/**
+ * @file  : Driver_TASK.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum and function using in Driver_TASK.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_TASK_H_
+#define _DRIVER_TASK_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TASK_MAX_TASKS (8u)     /*Number of tasks, one bit each in the ready bitmap*/
+
+/*******************************************************************************
+ * Typedef
+ ******************************************************************************/
+
+/**
+ * @brief function of a task, events are the event bits posted since its last run.
+ */
+typedef void (*task_function)(void *context, uint32_t events);
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Information about a task configuration
+ */
+typedef struct TASK_config
+{
+    uint8_t priority;               /*Priority of the task, 0 is the highest, it also names the task*/
+    task_function task_func;        /*Function run to completion when an event is posted to the task*/
+    void *context;                  /*Pointer passed to the function*/
+    uint32_t min_interval_ticks;    /*Shortest time between the starts of two runs in timer ticks, 0 for no limit*/
+} TASK_config_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Create a task, a task created before with the same priority is replaced
+ *
+ * The rate limit and the periodic events run on the software timers, Driver_TIMER_init must be called first
+ * when they are used. It is ignored if min_interval_ticks is over TIMER_MAX_DELAY_TICKS.
+ *
+ * @param TASK_config is a struct pointer has the information about the task configuration
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TASK_create(TASK_config_info *TASK_config);
+
+/**
+ * @brief Post events to a task
+ *
+ * It can be called from any interrupt. The events of the task are ORed together until it runs, the task is
+ * ready unless its rate limit holds it back. It is ignored if the task is not created.
+ *
+ * @param priority is the priority of the task
+ * @param events is the event bits to post, 0 is ignored
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TASK_post(uint8_t priority, uint32_t events);
+
+/**
+ * @brief Post events to a task periodically from a software timer
+ *
+ * @param priority is the priority of the task
+ * @param events is the event bits to post at each period
+ * @param period_ticks is the period in timer ticks, 0 stops the periodic events
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TASK_start_periodic(uint8_t priority, uint32_t events, uint32_t period_ticks);
+
+/**
+ * @brief Run the tasks, this function never returns
+ *
+ * The ready task of highest priority is found in O(1) from the ready bitmap and runs to completion; a task is not
+ * preempted by another task, only by the interrupts. The core sleeps while no task is ready.
+ *
+ * @param: This function has no parameter.
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TASK_run(void);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -0,0 +1,137 @@
+/**
+ * @file  : Driver_TIMER.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum, typdef, macro and function using in Driver_TIMER.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "../Includes/Driver/Driver_PIT.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_TIMER_H_
+#define _DRIVER_TIMER_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TIMER_WHEEL_SLOTS (32u)             /*Slots of the timer wheel, one bit each in the slot bitmap*/
+#define TIMER_MAX_DELAY_TICKS (0x7FFFFFFFu) /*Longest delay or period, the tick counter wraps at 2^32*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Link of a timer in a slot of the wheel
+ */
+typedef struct TIMER_link
+{
+    struct TIMER_link *next;    /*Next timer of the slot, NULL while the timer is not started*/
+    struct TIMER_link *prev;    /*Previous timer of the slot*/
+} TIMER_link_info;
+
+/**
+ * @brief Information about a software timer, the entry is owned by the caller and must start zeroed
+ */
+typedef struct TIMER
+{
+    TIMER_link_info link;   /*Link in the wheel, it must be the first field*/
+    uint32_t expiry;        /*Tick of the next expiry*/
+    uint32_t period;        /*Ticks between two expiries, 0 for a one-shot timer*/
+    callback callback_func; /*Function called from the PIT interrupt at each expiry*/
+    void *context;          /*Pointer passed to the function*/
+} TIMER_info;
+
+/**
+ * @brief Information about the timer service configuration
+ */
+typedef struct TIMER_config
+{
+    uint8_t timer_index;    /*PIT timer of the service (0 / 1), it must not run a PWM group*/
+    uint32_t tick_counts;   /*Length of a tick in bus clock cycles*/
+} TIMER_config_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Init the software timer service on a PIT timer
+ *
+ * The timers are kept in a wheel of TIMER_WHEEL_SLOTS slots hashed by their expiry tick. The PIT timer is only
+ * loaded with the time to the next occupied slot, at most TIMER_WHEEL_SLOTS ticks, and is stopped while no timer
+ * runs, so an idle tick costs no interrupt. The timers started before are stopped.
+ *
+ * @param TIMER_config is a struct pointer has the information about the timer service configuration
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TIMER_init(TIMER_config_info *TIMER_config);
+
+/**
+ * @brief Start or restart a software timer
+ *
+ * It takes O(1): the timer is linked in the slot of its expiry. Call it from thread mode or from a timer callback,
+ * the interrupts are masked for the few instructions that change the wheel.
+ *
+ * @param timer is the entry of the timer
+ * @param delay_ticks is the number of ticks to the first expiry (1 to TIMER_MAX_DELAY_TICKS)
+ * @param period_ticks is the number of ticks between the next expiries, 0 for a one-shot timer
+ * @param callback_func is the function called from the PIT interrupt at each expiry
+ * @param context is passed to the function at each call
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TIMER_start(TIMER_info *timer, uint32_t delay_ticks, uint32_t period_ticks, callback callback_func,
+                        void *context);
+
+/**
+ * @brief Stop a software timer, a timer which is not running is not changed
+ *
+ * @param timer is the entry of the timer
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TIMER_stop(TIMER_info *timer);
+
+/**
+ * @brief Check if a software timer is running
+ *
+ * @param timer is the entry of the timer
+ *
+ * @return 1 if the timer waits for an expiry, 0 otherwise.
+ */
+uint8_t Driver_TIMER_is_running(TIMER_info *timer);
+
+/**
+ * @brief Read the tick counter of the timer service
+ *
+ * It only counts while a timer runs.
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the number of ticks elapsed, it wraps at 2^32.
+ */
+uint32_t Driver_TIMER_read_ticks(void);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
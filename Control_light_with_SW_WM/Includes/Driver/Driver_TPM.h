@@ -0,0 +1,158 @@
+/**
+ * @file  : Driver_TPM.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum, typdef, macro and function using in Driver_TPM.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "../Includes/Driver/Driver_common.h"
+#include "../Includes/Driver/Driver_PORT.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _DRIVER_TPM_H_
+#define _DRIVER_TPM_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TPM_MODULE_COUNT (3u)       /*Number of TPM modules (TPM0 to TPM2)*/
+#define TPM_MAX_PRESCALER (7u)      /*Highest prescaler, the clock is divided by 2^7*/
+#define TPM_MAX_MODULO (0xFFFEu)    /*Highest modulo, a match value of modulo + 1 still fits for 100% duty*/
+
+/*******************************************************************************
+ * Enum
+ ******************************************************************************/
+
+/**
+ * @brief Reference of the TPM channel mode, value of the MSB, MSA, ELSB and ELSA bits.
+ */
+typedef enum TPM_channel_mode_type
+{
+    TPM_CHANNEL_DISABLED = 0x00u,   /*Channel disabled, the pin is not driven by the TPM*/
+    TPM_PWM_HIGH_TRUE = 0x28u,      /*Edge-aligned PWM, pin set at overflow and cleared at match*/
+    TPM_PWM_LOW_TRUE = 0x24u,       /*Edge-aligned PWM, pin cleared at overflow and set at match*/
+} TPM_channel_mode_enum_t;
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Information about the TPM configuration
+ */
+typedef struct TPM_config
+{
+    uint8_t TPM_index;      /*Index of the TPM module (0 to 2)*/
+    uint8_t prescaler;      /*The TPM clock is divided by 2^prescaler (0 to TPM_MAX_PRESCALER)*/
+    uint16_t modulo;        /*Counter period is modulo + 1 counts (up to TPM_MAX_MODULO)*/
+} TPM_config_info;
+
+/**
+ * @brief Information about a pin which can be driven by a TPM channel
+ */
+typedef struct TPM_pin_route
+{
+    Port_type_enum_t port_type; /*PORT which contains the pin*/
+    uint8_t pin;                /*Pin number*/
+    uint8_t TPM_index;          /*Index of the TPM module*/
+    uint8_t channel;            /*Index of the TPM channel*/
+    Mux_type_enum_t mux_type;   /*MUX which routes the TPM channel to the pin*/
+} TPM_pin_route_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Init a TPM module and start its counter
+ *
+ * The clock gate of the module is enabled and the TPM clock source is MCGFLLCLK.
+ *
+ * @param TPM_config is a struct pointer has the information about the TPM configuration
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TPM_init(TPM_config_info *TPM_config);
+
+/**
+ * @brief Stop the counter of a TPM module, its channels keep their mode
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TPM_stop(uint8_t TPM_index);
+
+/**
+ * @brief Set the modulo of a TPM module, it is applied at the next counter overflow
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2)
+ * @param modulo is the new modulo (up to TPM_MAX_MODULO)
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TPM_set_modulo(uint8_t TPM_index, uint16_t modulo);
+
+/**
+ * @brief Set the mode of a TPM channel
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2)
+ * @param channel is the index of the TPM channel
+ * @param mode is the channel mode
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TPM_config_channel(uint8_t TPM_index, uint8_t channel, TPM_channel_mode_enum_t mode);
+
+/**
+ * @brief Set the match value of a TPM channel, it is applied at the next counter overflow
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2)
+ * @param channel is the index of the TPM channel
+ * @param value is the match value, modulo + 1 keeps the pulse on for the whole period
+ *
+ * @return: This function return nothing.
+ */
+void Driver_TPM_set_channel_value(uint8_t TPM_index, uint8_t channel, uint16_t value);
+
+/**
+ * @brief Read the counter of a TPM module
+ *
+ * @param TPM_index is the index of the TPM module (0 to 2)
+ *
+ * @return the counter value, it counts up from 0 to the modulo.
+ */
+uint16_t Driver_TPM_read_counter(uint8_t TPM_index);
+
+/**
+ * @brief Find the TPM channel which can drive a pin
+ *
+ * @param port_type is the PORT which contains the pin
+ * @param pin is the pin number
+ * @param route is the address to store the TPM module, channel and MUX of the pin
+ *
+ * @return 1 if the pin has a TPM channel, 0 otherwise.
+ */
+uint8_t Driver_TPM_find_pin_route(Port_type_enum_t port_type, uint8_t pin, TPM_pin_route_info *route);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -0,0 +1,75 @@
+/**
+ * @file  : HAL_CORE.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum and function using in HAL_CORE.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_CORE_H_
+#define _HAL_CORE_H_
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- PRIMASK register functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Mask all the interrupts of the core.
+ *
+ * @param: This function has no parameter
+ *
+ * @return the PRIMASK value of the caller, to give to HAL_CORE_PRIMASK_restore.
+ */
+uint32_t HAL_CORE_PRIMASK_disable_IRQ(void);
+
+/**
+ * @brief Restore the interrupt mask of the core.
+ *
+ * @param primask is the value returned by HAL_CORE_PRIMASK_disable_IRQ.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_CORE_PRIMASK_restore(uint32_t primask);
+
+/*!
+ * @}
+ */
+/* end of group PRIMASK register functions */
+
+/**
+ * @brief Put the core in sleep mode until an interrupt is pending.
+ *
+ * A pending interrupt wakes the core up even while PRIMASK masks it, the interrupt then runs once PRIMASK is
+ * restored. The bus clock keeps running, so the PIT, TPM and ADC keep working.
+ *
+ * @param: This function has no parameter
+ *
+ * @return: this function return nothing.
+ */
+void HAL_CORE_wait_for_IRQ(void);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -0,0 +1,192 @@
+/**
+ * @file  : HAL_DMA.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum and function using in HAL_DMA.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_DMA_H_
+#define _HAL_DMA_H_
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- SARn and DARn register functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the source address of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param SAR_value is the address of the first data to read.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_SARn_set_SAR(uint8_t channel, uint32_t SAR_value);
+
+/**
+ * @brief Read the source address of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return the address of the next data to read.
+ */
+uint32_t HAL_DMA_SARn_read_SAR(uint8_t channel);
+
+/**
+ * @brief Set the destination address of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param DAR_value is the address of the first data to write.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DARn_set_DAR(uint8_t channel, uint32_t DAR_value);
+
+/*!
+ * @}
+ */
+/* end of group SARn and DARn register functions */
+
+/* ----------------------------------------------------------------------------
+   -- DSR_BCRn register functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the number of bytes left to transfer by DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param BCR_value is the number of bytes (up to 0xFFFFF).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DSR_BCRn_set_BCR(uint8_t channel, uint32_t BCR_value);
+
+/**
+ * @brief Clear the done and error flags of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DSR_BCRn_set_DONE(uint8_t channel);
+
+/**
+ * @brief Read the done flag of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return 1 if the byte count reached 0 or an error stopped the channel, 0 otherwise.
+ */
+uint8_t HAL_DMA_DSR_BCRn_read_DONE(uint8_t channel);
+
+/*!
+ * @}
+ */
+/* end of group DSR_BCRn register functions */
+
+/* ----------------------------------------------------------------------------
+   -- DCRn register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the data size and the address increment of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param size_value is the value of the SSIZE and DSIZE bit fields(0 = 32 bits/ 1 = 8 bits/ 2 = 16 bits).
+ * @param SINC_value is the logic to set the SINC bit field(0 = fixed/ 1 = incremented source).
+ * @param DINC_value is the logic to set the DINC bit field(0 = fixed/ 1 = incremented destination).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_transfer(uint8_t channel, uint8_t size_value, uint8_t SINC_value, uint8_t DINC_value);
+
+/**
+ * @brief Set the source address modulo of DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param SMOD_value is the value of the SMOD bit field, the source wraps in a 2^(SMOD_value + 3) bytes buffer.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_SMOD(uint8_t channel, uint8_t SMOD_value);
+
+/**
+ * @brief Set one transfer per request on DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param CS_value is the logic to set the CS bit field(0 = continuous/ 1 = cycle steal).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_CS(uint8_t channel, uint8_t CS_value);
+
+/**
+ * @brief Set the channel linked to DMA channel n.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param LINKCC_value is the value of the LINKCC bit field(0 = no link/ 2 = link after each transfer).
+ * @param LCH1_value is the index of the linked channel.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_link(uint8_t channel, uint8_t LINKCC_value, uint8_t LCH1_value);
+
+/**
+ * @brief Set the peripheral request of DMA channel n enabled or disabled.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param ERQ_value is the logic to set the ERQ bit field(0 = Disabled/ 1 = Enabled).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_ERQ(uint8_t channel, uint8_t ERQ_value);
+
+/**
+ * @brief Set the interrupt at the end of the transfer of DMA channel n enabled or disabled.
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ * @param EINT_value is the logic to set the EINT bit field(0 = Disabled/ 1 = Enabled).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMA_DCRn_set_EINT(uint8_t channel, uint8_t EINT_value);
+
+/*!
+ * @}
+ */
+/* end of group DCRn register bit setting functions */
+
+/**
+ * @brief Enable the interrupt handler of DMA channel n
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return: This function return nothing
+ */
+void HAL_DMA_enable_IRQ_Handler(uint8_t channel);
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
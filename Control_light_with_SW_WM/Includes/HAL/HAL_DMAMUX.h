@@ -0,0 +1,75 @@
+/**
+ * @file  : HAL_DMAMUX.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum and function using in HAL_DMAMUX.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_DMAMUX_H_
+#define _HAL_DMAMUX_H_
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- CHCFGn register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set DMAMUX channel n enabled or disabled.
+ *
+ * @param channel is the index of the DMAMUX channel (0 to 3)
+ * @param ENBL_value is the logic to set the ENBL bit field(0 = Disabled/ 1 = Enabled).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMAMUX_CHCFGn_set_ENBL(uint8_t channel, uint8_t ENBL_value);
+
+/**
+ * @brief Set the periodic trigger of DMAMUX channel n enabled or disabled.
+ *
+ * @param channel is the index of the DMAMUX channel (0 to 3), channel n is triggered by PIT timer n
+ * @param TRIG_value is the logic to set the TRIG bit field(0 = Disabled/ 1 = Enabled).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMAMUX_CHCFGn_set_TRIG(uint8_t channel, uint8_t TRIG_value);
+
+/**
+ * @brief Select the request source of DMAMUX channel n.
+ *
+ * @param channel is the index of the DMAMUX channel (0 to 3)
+ * @param SOURCE_value is the value of the SOURCE bit field.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_DMAMUX_CHCFGn_set_SOURCE(uint8_t channel, uint8_t SOURCE_value);
+
+/*!
+ * @}
+ */
+/* end of group CHCFGn register bit setting functions */
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -74,6 +74,44 @@ uint8_t HAL_GPIO_read_PIN(GPIO_Type *port, uint8_t pin);
  */
 void HAL_GPIO_toggle_PIN(GPIO_Type *port, int8_t pin);
 
+/**
+ * @brief Set several pins of a port to high logic level in one write
+ *
+ * @param port is the GPIO register of the port.
+ * @param pin_mask has bit n set for each pin n to set.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_GPIO_set_PORT(GPIO_Type *port, uint32_t pin_mask);
+
+/**
+ * @brief Clear several pins of a port to low logic level in one write
+ *
+ * @param port is the GPIO register of the port.
+ * @param pin_mask has bit n set for each pin n to clear.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_GPIO_clear_PORT(GPIO_Type *port, uint32_t pin_mask);
+
+/**
+ * @brief Get the address of the set output register of a port, a DMA can write pin masks to it
+ *
+ * @param port is the GPIO register of the port.
+ *
+ * @return the address of PSOR, 0 if port is NULL.
+ */
+uint32_t HAL_GPIO_get_PSOR_address(GPIO_Type *port);
+
+/**
+ * @brief Get the address of the clear output register of a port, a DMA can write pin masks to it
+ *
+ * @param port is the GPIO register of the port.
+ *
+ * @return the address of PCOR, 0 if port is NULL.
+ */
+uint32_t HAL_GPIO_get_PCOR_address(GPIO_Type *port);
+
 /*Header guard*/
 #endif
 /*EOF*/
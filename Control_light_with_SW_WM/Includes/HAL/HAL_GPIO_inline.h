@@ -0,0 +1,86 @@
+/**
+ * @file  : HAL_GPIO_inline.h
+ * @author: Nguyen The Anh.
+ * @brief : Define the inline GPIO register access used in interrupt handlers.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_GPIO_INLINE_H_
+#define _HAL_GPIO_INLINE_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define HAL_FGPIO_PORT_STRIDE (FGPIOB_BASE - FGPIOA_BASE)   /*Distance between the registers of two ports*/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*
+ * The ports are written through the single-cycle FGPIO (IOPORT) alias of the
+ * GPIO registers, which the DMA cannot reach. Nothing is checked, init code and
+ * the DMA addresses use the functions of HAL_GPIO.h.
+ */
+
+/**
+ * @brief Get the FGPIO registers of a port.
+ *
+ * @param port_index is the index of the port (0 = PORT A to 4 = PORT E), it is not checked
+ *
+ * @return the FGPIO registers of the port.
+ */
+static inline FGPIO_Type *HAL_FGPIO_get_port_fast(uint8_t port_index)
+{
+    return (FGPIO_Type *)(FGPIOA_BASE + ((uint32_t)port_index * HAL_FGPIO_PORT_STRIDE));
+}
+
+/**
+ * @brief Set several pins of a port to high logic level in one write.
+ *
+ * @param port is the FGPIO register of the port.
+ * @param pin_mask has bit n set for each pin n to set.
+ *
+ * @return: this function return nothing.
+ */
+static inline void HAL_FGPIO_set_PORT_fast(FGPIO_Type *port, uint32_t pin_mask)
+{
+    port->PSOR = pin_mask;
+
+    return;
+}
+
+/**
+ * @brief Clear several pins of a port to low logic level in one write.
+ *
+ * @param port is the FGPIO register of the port.
+ * @param pin_mask has bit n set for each pin n to clear.
+ *
+ * @return: this function return nothing.
+ */
+static inline void HAL_FGPIO_clear_PORT_fast(FGPIO_Type *port, uint32_t pin_mask)
+{
+    port->PCOR = pin_mask;
+
+    return;
+}
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -75,6 +75,24 @@ void HAL_PIT_LDVALn_set_TSV(uint8_t timer_index, uint32_t TSV_value);
  */
 /* end of group LDVALn register bit setting functions */
 
+/* ----------------------------------------------------------------------------
+   -- CVALn register bit reading functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Read the current value of PIT timer n.
+ *
+ * @param timer_index is the index of PIT timer (0 or 1)
+ *
+ * @return the current value of the timer, it counts down from the load value.
+ */
+uint32_t HAL_PIT_CVALn_read_TVL(uint8_t timer_index);
+
+/*!
+ * @}
+ */
+/* end of group CVALn register bit reading functions */
+
 /* ----------------------------------------------------------------------------
   -- TCTRLn register bit setting functions group
   ---------------------------------------------------------------------------- */
@@ -141,6 +159,27 @@ void HAL_PIT_TFLGn_set_TIF(uint8_t timer_index);
  */
 /* end of group TFLGn register bit setting functions */
 
+/* ----------------------------------------------------------------------------
+   -- LTMR64H and LTMR64L register reading functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Read the 64-bit lifetime timer of the chained timers 0 and 1.
+ *
+ * LTMR64H is read first, it latches timer 0 in LTMR64L, so both words come from the same instant.
+ * The interrupts are masked between the two reads so that no other read moves the latch.
+ *
+ * @param: This function has no parameter
+ *
+ * @return the lifetime timer value, it counts down from the load values of both timers.
+ */
+uint64_t HAL_PIT_LTMR64_read_LT(void);
+
+/*!
+ * @}
+ */
+/* end of group LTMR64H and LTMR64L register reading functions */
+
 /**
  * @brief Enable the PIT interrupt handler
  *
@@ -150,6 +189,15 @@ void HAL_PIT_TFLGn_set_TIF(uint8_t timer_index);
  */
 void HAL_PIT_enable_IRQ_Handler(void);
 
+/**
+ * @brief Disable the PIT interrupt handler
+ *
+ * @param: This function has no parameter
+ *
+ * @return: This function return nothing
+ */
+void HAL_PIT_disable_IRQ_Handler(void);
+
 /*******************************************************************************
  * End of header guard
  ******************************************************************************/
@@ -0,0 +1,91 @@
+/**
+ * @file  : HAL_PIT_inline.h
+ * @author: Nguyen The Anh.
+ * @brief : Define the inline PIT register access used in interrupt handlers.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_PIT_INLINE_H_
+#define _HAL_PIT_INLINE_H_
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*
+ * The timer index is not checked, each function is a single load or store once
+ * inlined. Init code uses the checked functions of HAL_PIT.h.
+ */
+
+/**
+ * @brief Read the interrupt flag of timer n.
+ *
+ * @param timer_index is the index of PIT timer (0 or 1), it is not checked
+ *
+ * @return the state of the interrupt flag
+ */
+static inline uint8_t HAL_PIT_TFLGn_read_TIF_fast(uint8_t timer_index)
+{
+    return (uint8_t)(PIT->CHANNEL[timer_index].TFLG & PIT_TFLG_TIF_MASK);
+}
+
+/**
+ * @brief Clear the interrupt flag of timer n.
+ *
+ * @param timer_index is the index of PIT timer (0 or 1), it is not checked
+ *
+ * @return: This function return nothing
+ */
+static inline void HAL_PIT_TFLGn_clear_TIF_fast(uint8_t timer_index)
+{
+    /*The flag is cleared by writing 1*/
+    PIT->CHANNEL[timer_index].TFLG = PIT_TFLG_TIF_MASK;
+
+    return;
+}
+
+/**
+ * @brief Set the load value of timer n, it is used at the next timeout.
+ *
+ * @param timer_index is the index of PIT timer (0 or 1), it is not checked
+ * @param TSV_value is the load value.
+ *
+ * @return: This function return nothing
+ */
+static inline void HAL_PIT_LDVALn_set_TSV_fast(uint8_t timer_index, uint32_t TSV_value)
+{
+    PIT->CHANNEL[timer_index].LDVAL = TSV_value;
+
+    return;
+}
+
+/**
+ * @brief Read the current value of timer n.
+ *
+ * @param timer_index is the index of PIT timer (0 or 1), it is not checked
+ *
+ * @return the current value of the timer, it counts down from the load value.
+ */
+static inline uint32_t HAL_PIT_CVALn_read_TVL_fast(uint8_t timer_index)
+{
+    return PIT->CHANNEL[timer_index].CVAL;
+}
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
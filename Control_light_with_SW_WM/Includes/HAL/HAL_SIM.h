@@ -104,10 +104,116 @@ void HAL_SIM_SCGC6_set_clock_ADC0(uint8_t ADC0_gate_value);
  */
 void HAL_SIM_SCGC6_set_clock_PIT(uint8_t PIT_gate_value);
 
+/**
+ * @brief Enable clock source for TPM0
+ *
+ * @param TPM0_gate_value is the value we will write to bit TPM0 in SCGC6 register.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SCGC6_set_clock_TPM0(uint8_t TPM0_gate_value);
+
+/**
+ * @brief Enable clock source for TPM1
+ *
+ * @param TPM1_gate_value is the value we will write to bit TPM1 in SCGC6 register.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SCGC6_set_clock_TPM1(uint8_t TPM1_gate_value);
+
+/**
+ * @brief Enable clock source for TPM2
+ *
+ * @param TPM2_gate_value is the value we will write to bit TPM2 in SCGC6 register.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SCGC6_set_clock_TPM2(uint8_t TPM2_gate_value);
+
+/**
+ * @brief Enable clock source for DMAMUX
+ *
+ * @param DMAMUX_gate_value is the value we will write to bit DMAMUX in SCGC6 register.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SCGC6_set_clock_DMAMUX(uint8_t DMAMUX_gate_value);
+
 /*!
  * @}
  */ /* end of group SCGC6 register bit setting function */
 
+/* ----------------------------------------------------------------------------
+   -- SCGC7 register bit setting function group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Enable clock source for DMA
+ *
+ * @param DMA_gate_value is the value we will write to bit DMA in SCGC7 register.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SCGC7_set_clock_DMA(uint8_t DMA_gate_value);
+
+/*!
+ * @}
+ */ /* end of group SCGC7 register bit setting function */
+
+/* ----------------------------------------------------------------------------
+   -- CLKDIV1 register bit reading function group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Read the bus clock divider
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the OUTDIV4 bit field, the bus clock is the core clock divided by (OUTDIV4 + 1).
+ */
+uint8_t HAL_SIM_CLKDIV1_read_OUTDIV4(void);
+
+/**
+ * @brief Read the core clock divider
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the OUTDIV1 bit field, the core clock is MCGOUTCLK divided by (OUTDIV1 + 1).
+ */
+uint8_t HAL_SIM_CLKDIV1_read_OUTDIV1(void);
+
+/*!
+ * @}
+ */ /* end of group CLKDIV1 register bit reading function */
+
+/* ----------------------------------------------------------------------------
+   -- SOPT2 register bit setting function group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Select the clock source of the TPM modules
+ *
+ * @param TPMSRC_value is the value of the TPMSRC bit field(0 = disabled/ 1 = MCGFLLCLK or MCGPLLCLK/2/
+ *        2 = OSCERCLK/ 3 = MCGIRCLK).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_SIM_SOPT2_set_TPMSRC(uint8_t TPMSRC_value);
+
+/**
+ * @brief Read which of the FLL or the PLL clocks the peripherals
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the PLLFLLSEL bit field(0 = MCGFLLCLK/ 1 = MCGPLLCLK/2).
+ */
+uint8_t HAL_SIM_SOPT2_read_PLLFLLSEL(void);
+
+/*!
+ * @}
+ */ /* end of group SOPT2 register bit setting function */
+
 /*Header guard*/
 #endif
 /*EOF*/
\ No newline at end of file
@@ -0,0 +1,160 @@
+/**
+ * @file  : HAL_TPM.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare enum and function using in HAL_TPM.c.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _HAL_TPM_H_
+#define _HAL_TPM_H_
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- SC register bit setting function group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Select the clock of the TPM counter.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ * @param CMOD_value is the value of the CMOD bit field(0 = counter disabled/ 1 = TPM clock).
+ *
+ * @return: this function return nothing.
+ */
+void HAL_TPM_SC_set_CMOD(TPM_Type *TPM_selected, uint8_t CMOD_value);
+
+/**
+ * @brief Select the prescaler of the TPM counter clock.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ * @param PS_value is the value of the PS bit field, the clock is divided by 2^PS_value.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_TPM_SC_set_PS(TPM_Type *TPM_selected, uint8_t PS_value);
+
+/*!
+ * @}
+ */
+/* end of group SC register bit setting functions */
+
+/* ----------------------------------------------------------------------------
+   -- SC register bit reading functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Read the clock selection of the TPM counter.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ *
+ * @return the CMOD bit field, it reads the old value until the counter clock acknowledges a write.
+ */
+uint8_t HAL_TPM_SC_read_CMOD(TPM_Type *TPM_selected);
+
+/*!
+ * @}
+ */
+/* end of group SC register bit reading functions */
+
+/* ----------------------------------------------------------------------------
+   -- CNT register bit reading functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Read the TPM counter.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ *
+ * @return the counter value, it counts up from 0 to the modulo.
+ */
+uint16_t HAL_TPM_CNT_read_COUNT(TPM_Type *TPM_selected);
+
+/*!
+ * @}
+ */
+/* end of group CNT register bit reading functions */
+
+/* ----------------------------------------------------------------------------
+   -- MOD register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the modulo of the TPM counter.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ * @param MOD_value is the last value of the counter before it overflows.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_TPM_MOD_set_MOD(TPM_Type *TPM_selected, uint16_t MOD_value);
+
+/*!
+ * @}
+ */
+/* end of group MOD register bit setting functions */
+
+/* ----------------------------------------------------------------------------
+   -- CnSC register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the mode of TPM channel n.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ * @param channel is the channel index (0 to 5).
+ * @param mode_value is the value of the MSB, MSA, ELSB and ELSA bit fields.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_TPM_CnSC_set_mode(TPM_Type *TPM_selected, uint8_t channel, uint8_t mode_value);
+
+/*!
+ * @}
+ */
+/* end of group CnSC register bit setting functions */
+
+/* ----------------------------------------------------------------------------
+   -- CnV register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/**
+ * @brief Set the match value of TPM channel n.
+ *
+ * @param TPM_selected is the TPM module we're working on(TPM0, TPM1, TPM2).
+ * @param channel is the channel index (0 to 5).
+ * @param VAL_value is the counter value where the PWM pulse ends.
+ *
+ * @return: this function return nothing.
+ */
+void HAL_TPM_CnV_set_VAL(TPM_Type *TPM_selected, uint8_t channel, uint16_t VAL_value);
+
+/*!
+ * @}
+ */
+/* end of group CnV register bit setting functions */
+
+/*******************************************************************************
+ * End of header guard
+ ******************************************************************************/
+#endif
+/*EOF*/
@@ -0,0 +1,261 @@
+/**
+ * @file  : Driver_DMA.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_DMA.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_DMA.h"
+#include "../Includes/Driver/Driver_DMA.h"
+#include "../Includes/Driver/Driver_SIM.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static DMA_callback func_callback_ptr[DMA_CHANNEL_COUNT] = {NULL, NULL, NULL, NULL};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Clear the flags of a DMA channel and call its callback
+ *
+ * @param channel is the index of the DMA channel (0 to 3)
+ *
+ * @return: This function return nothing.
+ */
+static void DMA_handle_IRQ(uint8_t channel);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_register_callback.
+* Description: Register a callback function for a DMA channel interrupt handler
+*
+END***************************************************************************/
+void Driver_DMA_register_callback(uint8_t channel, DMA_callback callback_func)
+{
+    /*Check channel index*/
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        /*Register callback function*/
+        func_callback_ptr[channel] = callback_func;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: DMA_handle_IRQ.
+* Description: Common part of the DMA channel interrupt handlers
+*
+END***************************************************************************/
+static void DMA_handle_IRQ(uint8_t channel)
+{
+    /*Clear done and error flags*/
+    HAL_DMA_DSR_BCRn_set_DONE(channel);
+
+    /*If callback pointer is not NULL*/
+    if (NULL != func_callback_ptr[channel])
+    {
+        /*Call the callback function*/
+        func_callback_ptr[channel]();
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: DMA0_IRQHandler.
+* Description: Interrupt handler of DMA channel 0
+*
+END***************************************************************************/
+void DMA0_IRQHandler(void)
+{
+    DMA_handle_IRQ(0);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: DMA1_IRQHandler.
+* Description: Interrupt handler of DMA channel 1
+*
+END***************************************************************************/
+void DMA1_IRQHandler(void)
+{
+    DMA_handle_IRQ(1);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: DMA2_IRQHandler.
+* Description: Interrupt handler of DMA channel 2
+*
+END***************************************************************************/
+void DMA2_IRQHandler(void)
+{
+    DMA_handle_IRQ(2);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: DMA3_IRQHandler.
+* Description: Interrupt handler of DMA channel 3
+*
+END***************************************************************************/
+void DMA3_IRQHandler(void)
+{
+    DMA_handle_IRQ(3);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_init.
+* Description: Init a DMA channel in cycle steal mode
+*
+END***************************************************************************/
+uint8_t Driver_DMA_init(DMA_config_info *DMA_config)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    /*Check input*/
+    if ((NULL != DMA_config) && (DMA_config->channel < DMA_CHANNEL_COUNT) &&
+        (DMA_config->linked_channel < DMA_CHANNEL_COUNT) && (DMA_config->byte_count <= DMA_MAX_BYTE_COUNT))
+    {
+        Driver_SIM_set_DMA_clock(ENABLED);
+
+        /*Stop the requests and clear the flags of a previous transfer*/
+        HAL_DMA_DCRn_set_ERQ(DMA_config->channel, 0u);
+        HAL_DMA_DSR_BCRn_set_DONE(DMA_config->channel);
+
+        HAL_DMA_SARn_set_SAR(DMA_config->channel, DMA_config->source_address);
+        HAL_DMA_DARn_set_DAR(DMA_config->channel, DMA_config->destination_address);
+        HAL_DMA_DSR_BCRn_set_BCR(DMA_config->channel, DMA_config->byte_count);
+
+        HAL_DMA_DCRn_set_transfer(DMA_config->channel, (uint8_t)DMA_config->size,
+                                  DMA_config->source_increment, DMA_config->destination_increment);
+        HAL_DMA_DCRn_set_SMOD(DMA_config->channel, (uint8_t)DMA_config->source_modulo);
+        HAL_DMA_DCRn_set_CS(DMA_config->channel, 1u);
+        HAL_DMA_DCRn_set_link(DMA_config->channel, (uint8_t)DMA_config->link, DMA_config->linked_channel);
+        HAL_DMA_DCRn_set_EINT(DMA_config->channel, (uint8_t)DMA_config->IRQ_state);
+
+        /*Check if interrupt request is enabled*/
+        if (DMA_IRQ_ENABLED == DMA_config->IRQ_state)
+        {
+            /*Enable interrupt handler*/
+            HAL_DMA_enable_IRQ_Handler(DMA_config->channel);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        HAL_DMA_DCRn_set_ERQ(DMA_config->channel, (uint8_t)DMA_config->request_state);
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_stop.
+* Description: Stop the requests of a DMA channel and clear its flags
+*
+END***************************************************************************/
+void Driver_DMA_stop(uint8_t channel)
+{
+    /*Check channel index*/
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        HAL_DMA_DCRn_set_ERQ(channel, 0u);
+        HAL_DMA_DCRn_set_EINT(channel, 0u);
+        HAL_DMA_DSR_BCRn_set_DONE(channel);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_set_byte_count.
+* Description: Set the number of bytes left to move by a DMA channel
+*
+END***************************************************************************/
+void Driver_DMA_set_byte_count(uint8_t channel, uint32_t byte_count)
+{
+    /*Check input*/
+    if ((channel < DMA_CHANNEL_COUNT) && (byte_count <= DMA_MAX_BYTE_COUNT))
+    {
+        HAL_DMA_DSR_BCRn_set_BCR(channel, byte_count);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_read_source_address.
+* Description: Read the source address of a DMA channel
+*
+END***************************************************************************/
+uint32_t Driver_DMA_read_source_address(uint8_t channel)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    /*Check channel index*/
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        ret_val = HAL_DMA_SARn_read_SAR(channel);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+/*EOF*/
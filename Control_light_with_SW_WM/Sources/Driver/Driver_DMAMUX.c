@@ -0,0 +1,76 @@
+/**
+ * @file  : Driver_DMAMUX.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_DMAMUX.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_DMAMUX.h"
+#include "../Includes/Driver/Driver_DMAMUX.h"
+#include "../Includes/Driver/Driver_SIM.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMAMUX_init
+* Description: Route a request source to a DMA channel
+*
+END***************************************************************************/
+void Driver_DMAMUX_init(DMAMUX_config_info *DMAMUX_config)
+{
+    /*Check input, the PIT trigger only exists on channels 0 and 1*/
+    if ((NULL != DMAMUX_config) && (DMAMUX_config->channel < DMAMUX_CHANNEL_COUNT) &&
+        ((DMAMUX_TRIGGER_DISABLED == DMAMUX_config->trigger) || (DMAMUX_config->channel <= 1u)))
+    {
+        Driver_SIM_set_DMA_clock(ENABLED);
+
+        /*The channel can only be changed while it is disabled*/
+        HAL_DMAMUX_CHCFGn_set_ENBL(DMAMUX_config->channel, 0u);
+        HAL_DMAMUX_CHCFGn_set_SOURCE(DMAMUX_config->channel, (uint8_t)DMAMUX_config->source);
+        HAL_DMAMUX_CHCFGn_set_TRIG(DMAMUX_config->channel, (uint8_t)DMAMUX_config->trigger);
+        HAL_DMAMUX_CHCFGn_set_ENBL(DMAMUX_config->channel, 1u);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMAMUX_disable
+* Description: Stop the requests to a DMA channel
+*
+END***************************************************************************/
+void Driver_DMAMUX_disable(uint8_t channel)
+{
+    /*Check channel index*/
+    if (channel < DMAMUX_CHANNEL_COUNT)
+    {
+        HAL_DMAMUX_CHCFGn_set_ENBL(channel, 0u);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+/*EOF*/
@@ -142,4 +142,90 @@ void Driver_GPIO_toggle_pin_state(Port_type_enum_t port_type, uint8_t pin)
 
     return;
 }
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_set_port_pins
+* Description: Set the pins of a PORT given by a mask.
+*
+END***************************************************************************/
+void Driver_GPIO_set_port_pins(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    if ((PORT_A <= port_type && port_type <= PORT_E))
+    {
+        /*Set the pins in one write*/
+        HAL_GPIO_set_PORT(GPIO_port_array[port_type], pin_mask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_clear_port_pins
+* Description: Clear the pins of a PORT given by a mask.
+*
+END***************************************************************************/
+void Driver_GPIO_clear_port_pins(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    if ((PORT_A <= port_type && port_type <= PORT_E))
+    {
+        /*Clear the pins in one write*/
+        HAL_GPIO_clear_PORT(GPIO_port_array[port_type], pin_mask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_get_set_register_address
+* Description: Get the address of the register which sets the pins of a PORT
+*
+END***************************************************************************/
+uint32_t Driver_GPIO_get_set_register_address(Port_type_enum_t port_type)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if ((PORT_A <= port_type && port_type <= PORT_E))
+    {
+        ret_val = HAL_GPIO_get_PSOR_address(GPIO_port_array[port_type]);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_get_clear_register_address
+* Description: Get the address of the register which clears the pins of a PORT
+*
+END***************************************************************************/
+uint32_t Driver_GPIO_get_clear_register_address(Port_type_enum_t port_type)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if ((PORT_A <= port_type && port_type <= PORT_E))
+    {
+        ret_val = HAL_GPIO_get_PCOR_address(GPIO_port_array[port_type]);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
 /*EOF*/
@@ -13,14 +13,60 @@
  ******************************************************************************/
 
 #include "../Includes/HAL/HAL_PIT.h"
+#include "../Includes/HAL/HAL_PIT_inline.h"
 #include "../Includes/Driver/Driver_PIT.h"
+#include "../Includes/Driver/Driver_SIM.h"
 #include <stdlib.h>
 
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define PIT_LIFETIME_LOAD_VALUE (0xFFFFFFFFu)   /*Load value of both timers of the lifetime timer*/
+#define PIT_US_PER_SECOND (1000000u)            /*Microseconds per second*/
+#define PIT_NS_PER_SECOND (1000000000u)         /*Nanoseconds per second*/
+#define PIT_PARTS_PER_MILLION (1000000)         /*Scale of an error in ppm*/
+#define PIT_PARTS_PER_BILLION (1000000000)      /*Scale of an error in ppb*/
+#define PIT_FRACTION_SHIFT (16u)                /*Fractional bits of a fractional load value*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Callback of a timer no function is registered for
+ *
+ * @param context is not used
+ *
+ * @return: this function return nothing.
+ */
+static void PIT_no_callback(void *context);
+
+/**
+ * @brief Scale the relative error of an interval against the exact one
+ *
+ * @param exact is the exact interval times the target frequency, in the unit of interval
+ * @param interval is the interval really loaded, times the target frequency
+ * @param scale is the number of parts the error is expressed in (ppm / ppb)
+ *
+ * @return (exact - interval) / interval in parts of scale, rounded to nearest.
+ */
+static int32_t PIT_relative_error(uint64_t exact, uint64_t interval, int64_t scale);
+
 /*******************************************************************************
  * Variable
  ******************************************************************************/
 
-static callback func_callback_ptr = NULL;
+/*Callback and context of each timer, a timer without callback calls a function doing nothing*/
+static PIT_callback_info PIT_callbacks[2] = {{PIT_no_callback, NULL}, {PIT_no_callback, NULL}};
+
+static uint32_t fractional_load[2] = {0, 0};    /*Whole part of the fractional load value of each timer*/
+static uint16_t fractional_step[2] = {0, 0};    /*Fraction of a count added per timeout, 16 fractional bits*/
+static uint16_t fractional_error[2] = {0, 0};   /*Fraction of a count accumulated over the timeouts*/
+
+static uint8_t timer_claimed = 0;               /*Bit n set from the init of timer n until it is released*/
+static uint8_t lifetime_running = 0;            /*Both timers run the lifetime timer*/
+static uint32_t lifetime_bus_clock = 0;         /*Bus clock frequency in Hz when the lifetime timer started*/
 
 /*******************************************************************************
  * Functions
@@ -28,55 +74,75 @@ static callback func_callback_ptr = NULL;
 
 /*Functions*********************************************************************
 *
-* Function name: Driver_PIT_register_callabck.
-* Description: Register a callback function for PIT interrupt handler
+* Function name: PIT_no_callback.
+* Description: Callback of a timer no function is registered for
 *
 END***************************************************************************/
-void Driver_PIT_register_callabck(callback callback_func)
+static void PIT_no_callback(void *context)
 {
-    /*Register callback function*/
-    func_callback_ptr = callback_func;
+    (void)context;
 
     return;
 }
 
 /*Functions*********************************************************************
 *
-* Function name: PIT_IRQHandler.
-* Description: Interrupt handler of the PIT module
+* Function name: Driver_PIT_register_callabck.
+* Description: Register a callback function and its context of timer n for
+*              PIT interrupt handler
 *
 END***************************************************************************/
-void PIT_IRQHandler(void)
+void Driver_PIT_register_callabck(uint8_t timer_index, callback callback_func, void *context)
 {
-    /*If timer 0 send interrupt request*/
-    if (0 == HAL_PIT_TFLGn_read_TIF(0))
-    {
-        /*Clear interrupt flag*/
-        HAL_PIT_TFLGn_set_TIF(0);
-    }
-    /*If timer 1 send interrupt request*/
-    else if (1 == HAL_PIT_TFLGn_read_TIF(1))
+    /*Check timer index*/
+    if (timer_index <= 1)
     {
-        /*Clear interrupt flag*/
-        HAL_PIT_TFLGn_set_TIF(1);
+        PIT_callbacks[timer_index].context = context;
+
+        /*Register callback function, NULL removes the callback of the timer*/
+        if (NULL != callback_func)
+        {
+            PIT_callbacks[timer_index].callback_func = callback_func;
+        }
+        else
+        {
+            PIT_callbacks[timer_index].callback_func = PIT_no_callback;
+        }
     }
     else
     {
-        /*Clear interrupt flag of timer 0*/
-        HAL_PIT_TFLGn_set_TIF(0);
-        /*Clear interrupt flag of timer 1*/
-        HAL_PIT_TFLGn_set_TIF(1);
+        /*Do nothing*/
     }
 
-    /*If callback pointer is not NULL*/
-    if (NULL != func_callback_ptr)
-    {
-        /*Call the callback function*/
-        func_callback_ptr();
-    }
-    else
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_IRQHandler.
+* Description: Interrupt handler of the PIT module
+*
+END***************************************************************************/
+void PIT_IRQHandler(void)
+{
+    uint8_t timer_index = 0;    /*Index of the timer*/
+
+    /*Both timers share the interrupt, each flag set is serviced, the register accesses are inlined*/
+    for (timer_index = 0; timer_index <= 1; timer_index++)
     {
-        /*Do nothing*/
+        /*If timer n send interrupt request*/
+        if (1 == HAL_PIT_TFLGn_read_TIF_fast(timer_index))
+        {
+            /*Clear interrupt flag*/
+            HAL_PIT_TFLGn_clear_TIF_fast(timer_index);
+
+            /*Call the callback function with its context, every entry has a function*/
+            PIT_callbacks[timer_index].callback_func(PIT_callbacks[timer_index].context);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
     }
 
     return;
@@ -90,15 +156,25 @@ void PIT_IRQHandler(void)
 END***************************************************************************/
 void Driver_PIT_init(PIT_config_info *PIT_config)
 {
-    /*Check input*/
-    if (NULL != PIT_config)
+    /*Check input, the lifetime timer keeps both timers*/
+    if ((NULL != PIT_config) && (0 == lifetime_running))
     {
         /*Configure the MCR register*/
         Driver_PIT_config_MCR(&(PIT_config->MCR_config));
+        /*Set load value for PIT timer n before it is started*/
+        Driver_PIT_set_load_value(PIT_config->TCTRLn_config.timer_index, PIT_config->load_value);
         /*Configure the TCTRLn register*/
         Driver_PIT_config_TCTRLn(&(PIT_config->TCTRLn_config));
-        /*Set load value for PIT timer n*/
-        Driver_PIT_set_load_value(PIT_config->TCTRLn_config.timer_index, PIT_config->load_value);
+
+        /*The timer is kept from the lifetime timer until it is released*/
+        if (PIT_config->TCTRLn_config.timer_index <= 1)
+        {
+            timer_claimed |= (uint8_t)(1u << PIT_config->TCTRLn_config.timer_index);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
 
         /*Check if interrupt request is enabled*/
         if ((IRQ_ENABLED == PIT_config->TCTRLn_config.IRQ_state))
@@ -119,6 +195,157 @@ void Driver_PIT_init(PIT_config_info *PIT_config)
     return;
 }
 
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_release_timer
+* Description: Stop timer n and remove its interrupt, chain mode and
+*              callback, the lifetime timer can then take it
+*
+END***************************************************************************/
+void Driver_PIT_release_timer(uint8_t timer_index)
+{
+    /*Check timer index, the lifetime timer keeps both timers*/
+    if ((timer_index <= 1) && (0 == lifetime_running))
+    {
+        HAL_PIT_TCTRLn_set_TIE(timer_index, (uint8_t)IRQ_DISABLED);
+        HAL_PIT_TCTRLn_set_TEN(timer_index, (uint8_t)TIMER_DISABLED);
+        HAL_PIT_TCTRLn_set_CHN(timer_index, (uint8_t)CHAIN_MODE_DISABLED);
+        Driver_PIT_register_callabck(timer_index, NULL, NULL);
+        HAL_PIT_TFLGn_set_TIF(timer_index);
+
+        timer_claimed &= (uint8_t)~(1u << timer_index);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_start_lifetime_timer
+* Description: Chain timer 1 to timer 0, both counting down from
+*              0xFFFFFFFF without interrupt, timer 1 is started first.
+*              The bus clock is read once, for the conversions.
+*
+END***************************************************************************/
+uint8_t Driver_PIT_start_lifetime_timer(void)
+{
+    /*Timer configuration info*/
+    TCTRL_config_info TCTRLn_config = {
+        .timer_index = 1,
+        .timer_state = TIMER_ENABLED,
+        .IRQ_state = IRQ_DISABLED,
+        .chain_mode = CHAIN_MODE_ENABLED,
+    };
+
+    /*MCR configuration info*/
+    MCR_config_info MCR_config = {
+        .freeze_mode = TIMERS_STOPPED_IN_DEBUG,
+        .module_state = PIT_ENABLED,
+    };
+
+    /*The lifetime timer is started once, on timers no PWM group or software timer uses*/
+    if ((0 == lifetime_running) && (0 == timer_claimed))
+    {
+        lifetime_bus_clock = Driver_SIM_get_bus_clock();
+        Driver_PIT_config_MCR(&MCR_config);
+
+        /*Timer 1 counts the timeouts of timer 0*/
+        Driver_PIT_select_Timer_state(0, TIMER_DISABLED);
+        Driver_PIT_select_Timer_state(1, TIMER_DISABLED);
+        Driver_PIT_set_load_value(1, PIT_LIFETIME_LOAD_VALUE);
+        Driver_PIT_config_TCTRLn(&TCTRLn_config);
+
+        /*Timer 0 counts the bus clock*/
+        TCTRLn_config.timer_index = 0;
+        TCTRLn_config.chain_mode = CHAIN_MODE_DISABLED;
+        Driver_PIT_set_load_value(0, PIT_LIFETIME_LOAD_VALUE);
+        Driver_PIT_config_TCTRLn(&TCTRLn_config);
+
+        lifetime_running = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return lifetime_running;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_read_lifetime
+* Description: The lifetime timer counts down from all ones, its complement
+*              is the number of bus clock cycles since it was started
+*
+END***************************************************************************/
+uint64_t Driver_PIT_read_lifetime(void)
+{
+    uint64_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (1 == lifetime_running)
+    {
+        ret_val = ~HAL_PIT_LTMR64_read_LT();
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_counts_to_us
+* Description: Whole seconds and the remainder are converted apart, so the
+*              product never overflows 64 bits
+*
+END***************************************************************************/
+uint64_t Driver_PIT_counts_to_us(uint64_t counts)
+{
+    uint64_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (1 == lifetime_running)
+    {
+        ret_val = ((counts / lifetime_bus_clock) * PIT_US_PER_SECOND) +
+                  (((counts % lifetime_bus_clock) * PIT_US_PER_SECOND) / lifetime_bus_clock);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_counts_to_ns
+* Description: Whole seconds and the remainder are converted apart, so the
+*              product never overflows 64 bits
+*
+END***************************************************************************/
+uint64_t Driver_PIT_counts_to_ns(uint64_t counts)
+{
+    uint64_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (1 == lifetime_running)
+    {
+        ret_val = ((counts / lifetime_bus_clock) * PIT_NS_PER_SECOND) +
+                  (((counts % lifetime_bus_clock) * PIT_NS_PER_SECOND) / lifetime_bus_clock);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
 /*Functions*********************************************************************
 *
 * Function name: Driver_PIT_config_MCR
@@ -193,10 +420,60 @@ void Driver_PIT_select_module_state(MCR_MDIS_type_enum_t module_state)
 END***************************************************************************/
 void Driver_PIT_set_load_value(uint8_t timer_index, uint32_t load_value)
 {
+    /*Check timer index, the lifetime timer keeps both timers*/
+    if ((timer_index <= 1) && (0 == lifetime_running))
+    {
+        /*Set load value for timer n*/
+        HAL_PIT_LDVALn_set_TSV(timer_index, load_value);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_read_current_value
+* Description: Read the current value of PIT timer n
+*
+END***************************************************************************/
+uint32_t Driver_PIT_read_current_value(uint8_t timer_index)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
     /*Check timer index*/
     if (timer_index <= 1)
     {
-        /*Set load value for timer n*/
+        /*Read current value of timer n*/
+        ret_val = HAL_PIT_CVALn_read_TVL(timer_index);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_set_fractional_load_value
+* Description: Set a load value with a fractional part for PIT timer n
+*
+END***************************************************************************/
+void Driver_PIT_set_fractional_load_value(uint8_t timer_index, uint32_t load_value, uint16_t fraction)
+{
+    /*Check timer index, the lifetime timer keeps both timers*/
+    if ((timer_index <= 1) && (0 == lifetime_running))
+    {
+        fractional_load[timer_index] = load_value;
+        fractional_step[timer_index] = fraction;
+        fractional_error[timer_index] = 0;
+
+        /*The first interval is the whole part*/
         HAL_PIT_LDVALn_set_TSV(timer_index, load_value);
     }
     else
@@ -207,6 +484,101 @@ void Driver_PIT_set_load_value(uint8_t timer_index, uint32_t load_value)
     return;
 }
 
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_update_fractional_load
+* Description: Bresenham step, the fraction is added to the error and its
+*              carry makes the next interval one count longer
+*
+END***************************************************************************/
+void Driver_PIT_update_fractional_load(uint8_t timer_index, int32_t offset)
+{
+    uint32_t error = 0; /*Error with the fraction of this timeout, 17 bits*/
+
+    /*Check timer index*/
+    if (timer_index <= 1)
+    {
+        error = (uint32_t)fractional_error[timer_index] + fractional_step[timer_index];
+        fractional_error[timer_index] = (uint16_t)error;
+
+        /*LDVAL is taken by the timer at its next reload*/
+        HAL_PIT_LDVALn_set_TSV(timer_index,
+                               (uint32_t)((int32_t)(fractional_load[timer_index] + (error >> 16)) + offset));
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_relative_error
+* Description: Round the scaled error away from 0 at half a part
+*
+END***************************************************************************/
+static int32_t PIT_relative_error(uint64_t exact, uint64_t interval, int64_t scale)
+{
+    int64_t difference = (int64_t)exact - (int64_t)interval;    /*Error of the interval, signed*/
+    int64_t half = (int64_t)(interval / 2u);                    /*Half of the divisor, for the rounding*/
+    int32_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    if (difference >= 0)
+    {
+        ret_val = (int32_t)(((difference * scale) + half) / (int64_t)interval);
+    }
+    else
+    {
+        ret_val = -(int32_t)((((-difference) * scale) + half) / (int64_t)interval);
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_calculate_rate
+* Description: Round the interval to whole counts and to 1/65536 count, then
+*              compare each one with the exact bus_clock / frequency
+*
+END***************************************************************************/
+uint8_t Driver_PIT_calculate_rate(uint32_t frequency, uint32_t bus_clock, PIT_rate_info *rate)
+{
+    uint32_t counts = 0;        /*Whole interval closest to the exact one*/
+    uint32_t whole = 0;         /*Whole part of the exact interval*/
+    uint64_t fraction = 0;      /*Fractional part of the exact interval, rounded, up to 65536*/
+    uint64_t interval = 0;      /*Average fractional interval, in 1/65536 of a count*/
+    uint8_t ret_val = 0;        /*This variable stores the return value of the function*/
+
+    /*Check input*/
+    if ((NULL != rate) && (0 != frequency) && (frequency <= bus_clock))
+    {
+        counts = (uint32_t)(((uint64_t)bus_clock + (frequency / 2u)) / frequency);
+        rate->load_value = counts - 1u;
+        rate->achieved_frequency = (uint32_t)(((uint64_t)bus_clock + (counts / 2u)) / counts);
+        rate->error_ppm = PIT_relative_error(bus_clock, (uint64_t)counts * frequency, PIT_PARTS_PER_MILLION);
+
+        whole = bus_clock / frequency;
+        fraction = ((((uint64_t)(bus_clock % frequency)) << PIT_FRACTION_SHIFT) + (frequency / 2u)) / frequency;
+        interval = ((uint64_t)whole << PIT_FRACTION_SHIFT) + fraction;
+
+        /*A fraction rounded up to a whole count is carried to the whole part*/
+        rate->fractional_load_value = (uint32_t)(interval >> PIT_FRACTION_SHIFT) - 1u;
+        rate->fraction = (uint16_t)interval;
+        rate->fractional_error_ppb = PIT_relative_error((uint64_t)bus_clock << PIT_FRACTION_SHIFT,
+                                                        interval * frequency, PIT_PARTS_PER_BILLION);
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
 /*Functions*********************************************************************
 *
 * Function name: Driver_PIT_config_TCTRLn
@@ -218,12 +590,12 @@ void Driver_PIT_config_TCTRLn(TCTRL_config_info *TCTRLn_config)
     /*Check input*/
     if (NULL != TCTRLn_config)
     {
-        /*Select timer n state*/
-        Driver_PIT_select_Timer_state(TCTRLn_config->timer_index, TCTRLn_config->timer_state);
+        /*Select timer n chain mode, a chained timer must not count the bus clock once enabled*/
+        Driver_PIT_select_Chain_Mode(TCTRLn_config->timer_index, TCTRLn_config->chain_mode);
         /*Select timer n interrupt request state*/
         Driver_PIT_select_IRQ_state(TCTRLn_config->timer_index, TCTRLn_config->IRQ_state);
-        /*Select timer n chain mode*/
-        Driver_PIT_select_Chain_Mode(TCTRLn_config->timer_index, TCTRLn_config->chain_mode);
+        /*Select timer n state*/
+        Driver_PIT_select_Timer_state(TCTRLn_config->timer_index, TCTRLn_config->timer_state);
     }
     else
     {
@@ -241,8 +613,8 @@ void Driver_PIT_config_TCTRLn(TCTRL_config_info *TCTRLn_config)
 END***************************************************************************/
 void Driver_PIT_select_Timer_state(uint8_t timer_index, TCTRL_TEN_type_enum_t timer_state)
 {
-    /*Check timer index input*/
-    if (timer_index <= 1)
+    /*Check timer index input, the lifetime timer keeps both timers*/
+    if ((timer_index <= 1) && (0 == lifetime_running))
     {
         /*Check timer state input*/
         if ((TIMER_DISABLED <= timer_state) && (timer_state <= TIMER_ENABLED))
@@ -344,4 +716,53 @@ void Driver_PIT_set_IRQ_flag(uint8_t timer_index)
 
     return;
 }
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_read_IRQ_flag
+* Description: Read the interrupt flag of timer n
+*
+END***************************************************************************/
+uint8_t Driver_PIT_read_IRQ_flag(uint8_t timer_index)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    /*Check timer index input*/
+    if (timer_index <= 1)
+    {
+        /*Read interrupt flag of timer n*/
+        ret_val = HAL_PIT_TFLGn_read_TIF(timer_index);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PIT_select_IRQ_handler_state
+* Description: Enable or mask the PIT interrupt handler in the NVIC
+*
+END***************************************************************************/
+void Driver_PIT_select_IRQ_handler_state(TCTRL_TIE_type_enum_t handler_state)
+{
+    /*Check input*/
+    if (IRQ_ENABLED == handler_state)
+    {
+        HAL_PIT_enable_IRQ_Handler();
+    }
+    else if (IRQ_DISABLED == handler_state)
+    {
+        HAL_PIT_disable_IRQ_Handler();
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
 /*EOF*/
@@ -0,0 +1,4071 @@
+/**
+ * @file  : Driver_PWM.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_PWM.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/Driver/Driver_PWM.h"
+#include "../Includes/Driver/Driver_PIT.h"
+#include "../Includes/Driver/Driver_SIM.h"
+#include "../Includes/Driver/Driver_TPM.h"
+#include "../Includes/Driver/Driver_PORT.h"
+#include "../Includes/Driver/Driver_DMA.h"
+#include "../Includes/Driver/Driver_DMAMUX.h"
+#include "../Includes/Driver/Driver_PIT_inline.h"
+#include "../Includes/Driver/Driver_GPIO_inline.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+/*Edge table holds an on and an off edge per channel plus the period start, or one edge per BAM bit*/
+#if (((2u * PWM_MAX_CHANNELS) + 1u) > PWM_BAM_MAX_BITS)
+#define PWM_MAX_EDGES ((2u * PWM_MAX_CHANNELS) + 1u)
+#else
+#define PWM_MAX_EDGES (PWM_BAM_MAX_BITS)
+#endif
+
+#define PWM_DMA_LINKED_CHANNEL (2u)     /*DMA channel writing the clear masks of group 0, group 1 uses the next one*/
+#define PWM_DMA_BYTE_COUNT (0xFF800u)   /*Bytes moved by the triggered DMA channel between two reloads*/
+#define PWM_DMA_LINKED_BYTE_COUNT (PWM_DMA_BYTE_COUNT + (4u * PWM_DMA_MAX_STEPS)) /*Bytes of the linked channel*/
+#define PWM_SPREAD_LFSR_TAPS (0xB400u)  /*Taps of the 16-bit Galois LFSR of the random spread*/
+#define PWM_PATTERN_UNMARKED (0xFFFFFFFFu)  /*Tick table: the channel has no mark in the pattern buffers*/
+#define PWM_REFINE_FIRST_STEP (3u)      /*Refined tick: first pulse end moved, the first two steps are queued before*/
+#define PWM_REFINE_MIN_STEP_COUNTS ((2u * PWM_MIN_EDGE_COUNTS) + 4u)  /*Refined tick: shortest step moving an edge*/
+
+/*The DMA rejects a byte count over its 20-bit field, the linked channel would never clear the pins*/
+#if (PWM_DMA_LINKED_BYTE_COUNT > DMA_MAX_BYTE_COUNT)
+#error "PWM_DMA_BYTE_COUNT leaves no room for the byte count of the linked DMA channel"
+#endif
+
+/*Both channels stop on a whole pattern, so a reload does not shift the set marks against the clear marks*/
+#if (0u != (PWM_DMA_BYTE_COUNT % (4u * PWM_DMA_MAX_STEPS)))
+#error "PWM_DMA_BYTE_COUNT must be a multiple of the pattern buffer size"
+#endif
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief One edge of the PWM period, it switches every channel changing at that time
+ */
+typedef struct PWM_edge
+{
+    uint32_t time;                          /*Edge time from the period start in PIT counts*/
+    uint32_t on_channels;                   /*Bit n set if the pulse of channel n turns on*/
+    uint32_t off_channels;                  /*Bit n set if the pulse of channel n turns off*/
+    uint32_t set_mask[PWM_PORT_COUNT];      /*Pins of each port driven high at the edge*/
+    uint32_t clear_mask[PWM_PORT_COUNT];    /*Pins of each port driven low at the edge*/
+    uint32_t late_set_mask[PWM_PORT_COUNT];     /*Pins of a pair turning on, driven high after the dead time*/
+    uint32_t late_clear_mask[PWM_PORT_COUNT];   /*Pins of a pair turning on, driven low after the dead time*/
+} PWM_edge_info;
+
+/**
+ * @brief State of the PWM group of one PIT timer
+ */
+typedef struct PWM_group
+{
+    PWM_config_info PWM_active_config;                        /*Configuration of the running PWM*/
+    PWM_channel_config_info channel_config[PWM_MAX_CHANNELS]; /*Output channels of the running PWM*/
+    uint8_t port_list[PWM_PORT_COUNT];                        /*Ports which contain an output channel*/
+    uint8_t port_count;                                       /*Number of ports in port_list*/
+    uint8_t port_slot[PWM_PORT_COUNT];                        /*Index of each port in port_list*/
+
+    volatile uint32_t shadow_duty[PWM_MAX_CHANNELS];          /*Shadow duty registers written by the foreground*/
+    volatile uint32_t shadow_sequence;                        /*Odd while the foreground writes the shadow registers*/
+    uint8_t update_open;                                      /*Foreground: a batch of duty updates is open*/
+    uint32_t latched_sequence;                                /*Sequence of the shadow registers in use*/
+    uint32_t latched_duty[PWM_MAX_CHANNELS];                  /*Duty latched at the last rollover, with sub-step bits*/
+    uint32_t active_duty[PWM_MAX_CHANNELS];                   /*Whole duty steps output in the period*/
+    uint32_t active_on_counts[PWM_MAX_CHANNELS];              /*On time of the period in PIT counts*/
+    uint32_t phase_steps[PWM_MAX_CHANNELS];                   /*Start of the pulse of each channel in duty steps*/
+    uint32_t phase_counts[PWM_MAX_CHANNELS];                  /*Start of the pulse of each channel in PIT counts*/
+    uint32_t counts_per_step;                                 /*PIT counts per duty step, 16 fractional bits*/
+    uint8_t table_dirty;                                      /*A duty changed since the edge table was built*/
+    uint32_t dither_error[PWM_MAX_CHANNELS];                  /*Dither: sub-step remainder carried across periods*/
+    volatile uint32_t shadow_fade_periods[PWM_MAX_CHANNELS];  /*Shadow fade length in periods, 0 sets the duty*/
+    volatile uint32_t shadow_fade_step[PWM_MAX_CHANNELS];     /*Shadow fade progress per period, 32 fractional bits*/
+    volatile uint8_t shadow_fade_curve[PWM_MAX_CHANNELS];     /*Shadow fade easing curve*/
+    uint32_t fade_target[PWM_MAX_CHANNELS];                   /*Fade: duty at the end of the latched request*/
+    uint32_t fade_periods[PWM_MAX_CHANNELS];                  /*Fade: length of the latched request in periods*/
+    uint8_t fade_curve[PWM_MAX_CHANNELS];                     /*Fade: easing curve of the latched request*/
+    uint32_t fade_start[PWM_MAX_CHANNELS];                    /*Fade: duty when the request was latched*/
+    uint32_t fade_left[PWM_MAX_CHANNELS];                     /*Fade: periods left, 0 once the target is reached*/
+    uint32_t fade_progress[PWM_MAX_CHANNELS];                 /*Fade: elapsed part of the fade, 32 fractional bits*/
+    uint32_t fade_step[PWM_MAX_CHANNELS];                     /*Fade: progress added per period*/
+
+    volatile uint32_t channel_levels;                         /*Bit n is the logic level of channel n*/
+    uint32_t output_levels;                                   /*Bit n is the level last written to channel n*/
+    volatile uint32_t running_load;                           /*Load value of the interval the PIT is counting*/
+
+    uint32_t ticks;                                           /*Tick mode: duty step index inside the period*/
+    uint8_t tick_table;                                       /*Tick mode: the interrupt writes the pattern buffers*/
+    uint32_t pattern_duty[PWM_MAX_CHANNELS];                  /*Tick mode: duty marked in the pattern buffers*/
+    uint16_t tick_fraction;                                   /*Tick mode: fraction of a count added to each step*/
+    int32_t tick_load_offset;                                 /*Tick mode: move of the step queued in LDVAL*/
+    uint8_t refine_count;                                     /*Refined tick: number of moved pulse ends*/
+    uint32_t refine_step[PWM_MAX_CHANNELS];                   /*Refined tick: step starting at each moved pulse end*/
+    int32_t refine_offset[PWM_MAX_CHANNELS];                  /*Refined tick: move of each pulse end in PIT counts*/
+    uint16_t refine_error[PWM_MAX_CHANNELS];                  /*Refined tick: fraction of a count carried over*/
+    volatile uint8_t PWM_stopped;                             /*The PIT is stopped while every output is static*/
+
+    PWM_edge_info edge_table[2][PWM_MAX_EDGES];               /*Edge mode: running and spare edge table*/
+    uint8_t edge_count[2];                                    /*Edge mode: number of edges in each table*/
+    uint8_t active_table;                                     /*Edge mode: table of the scheduled period*/
+    uint8_t edge_index;                                       /*Edge mode: next edge to schedule*/
+    PWM_edge_info *pending_edge;                              /*Edge mode: edge at the end of the running interval*/
+    uint32_t next_load;                                       /*Edge mode: load value written in LDVAL*/
+    uint8_t bam_bits;                                         /*BAM mode: number of duty bits*/
+
+    uint32_t pair_channels;                                   /*Bit n set if channel n is in a complementary pair*/
+    uint32_t dead_counts;                                     /*Dead time of the pairs in PIT counts*/
+
+    uint32_t spread_counts;                                   /*Spread: highest period change in PIT counts*/
+    uint32_t spread_limit;                                    /*Spread: highest change the running table allows*/
+    uint8_t spread_index;                                     /*Spread: edge followed by the stretched interval*/
+    int32_t spread_offset;                                    /*Spread: period change of the scheduled period*/
+    int32_t spread_drift;                                     /*Spread: sum of the period changes*/
+    uint8_t spread_step;                                      /*Spread: position in the triangle*/
+    int32_t spread_sum;                                       /*Spread: sum of the unit triangle levels of the cycle*/
+    uint16_t spread_lfsr;                                     /*Spread: state of the random generator*/
+
+    uint32_t hardware_channels;                               /*Bit n set if channel n is driven by a TPM channel*/
+    TPM_pin_route_info hardware_route[PWM_MAX_CHANNELS];      /*TPM module and channel of each hardware channel*/
+    uint32_t hardware_duty[PWM_MAX_CHANNELS];                 /*Duty of each hardware channel, with sub-step bits*/
+    uint32_t hardware_pending;                                /*Hardware channels written at the end of the batch*/
+    uint8_t TPM_used;                                         /*Bit n set if TPM n drives a channel*/
+    uint8_t TPM_prescaler;                                    /*TPM clock divider exponent of the PWM period*/
+    uint16_t TPM_modulo;                                      /*TPM modulo of the PWM period*/
+    uint32_t hardware_resolution;                             /*Duty steps of hardware_duty*/
+
+    uint32_t *pattern_set_buffer;                             /*Pins set at each duty step of the pattern*/
+    uint32_t *pattern_clear_buffer;                           /*Pins cleared at each duty step of the pattern*/
+    uint32_t DMA_pending;                                     /*DMA mode: channels written at the end of the batch*/
+
+    volatile uint8_t timing_pending;                          /*A new period and resolution wait for the rollover*/
+    uint32_t pending_period_counts;                           /*New PWM period in PIT counts*/
+    uint32_t pending_resolution;                              /*New number of duty steps*/
+
+#ifdef PWM_JITTER_MEASUREMENT
+    PWM_jitter_info jitter_record;                            /*Edge to pin write delay*/
+#endif
+} PWM_group_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*DMA and tick table: pins set and cleared at each duty step, one word per port, aligned for the DMA source modulo.
+  A row is one group, its size keeps the next row aligned*/
+static uint32_t pattern_set_buffers[PWM_GROUP_COUNT][PWM_DMA_MAX_STEPS]
+    __attribute__((aligned(PWM_DMA_MAX_STEPS * 4u)));
+static uint32_t pattern_clear_buffers[PWM_GROUP_COUNT][PWM_DMA_MAX_STEPS]
+    __attribute__((aligned(PWM_DMA_MAX_STEPS * 4u)));
+static PWM_group_info PWM_groups[PWM_GROUP_COUNT];     /*State of the PWM group of each PIT timer*/
+
+/*2^(n/16) in 16 fractional bits, the exponential fade interpolates between its entries*/
+static const uint32_t PWM_exp2_table[17] = {65536u, 68438u, 71468u, 74632u, 77936u, 81386u, 84990u, 88752u,
+                                            92682u, 96785u, 101070u, 105545u, 110218u, 115098u, 120194u,
+                                            125515u, 131072u};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Convert a duty in steps to an on time in PIT counts
+ *
+ * @param group is the PWM group
+ * @param duty is the on time in duty steps (0 to resolution)
+ *
+ * @return the on time in PIT counts.
+ */
+static uint32_t PWM_duty_to_counts(PWM_group_info *group, uint32_t duty);
+
+/**
+ * @brief Count the duty bits of a bit-angle modulation resolution
+ *
+ * @param resolution is the number of duty steps, (2^N - 1)
+ *
+ * @return N, the number of duty bits.
+ */
+static uint8_t PWM_count_bam_bits(uint32_t resolution);
+
+/**
+ * @brief Check that the PIT interrupt can sustain a PWM timing
+ *
+ * @param mode is the software PWM mode
+ * @param period_counts is the PWM period in PIT counts
+ * @param resolution is the number of duty steps per period
+ * @param dither_bits is the number of sub-step bits of the duty
+ *
+ * @return PWM_STATUS_OK if the timing can be used.
+ */
+static PWM_status_enum_t PWM_check_timing(PWM_mode_type_enum_t mode, uint32_t period_counts,
+                                          uint32_t resolution, uint8_t dither_bits);
+
+/**
+ * @brief Check that the channels of a DMA mode configuration are on one port
+ *
+ * @param PWM_config is the configuration to check
+ *
+ * @return 1 if the configuration is not in DMA mode or its channels share a port, 0 otherwise.
+ */
+static uint8_t PWM_check_ports(PWM_config_info *PWM_config);
+
+/**
+ * @brief Check the complementary pairs of a configuration
+ *
+ * @param PWM_config is the configuration to check
+ *
+ * @return 1 if every low side channel follows a channel which is not a low side, 0 otherwise.
+ */
+static uint8_t PWM_check_pairs(PWM_config_info *PWM_config);
+
+/**
+ * @brief Check the timebase of a configuration against the group of the other PIT timer
+ *
+ * @param PWM_config is the configuration to check
+ *
+ * @return 1 if the PIT timers the configuration needs are free, 0 otherwise.
+ */
+static uint8_t PWM_check_timebase(PWM_config_info *PWM_config);
+
+/**
+ * @brief Convert the dead time of a configuration to PIT counts
+ *
+ * @param PWM_config is the configuration
+ *
+ * @return the dead time in PIT counts.
+ */
+static uint32_t PWM_dead_time_to_counts(PWM_config_info *PWM_config);
+
+/**
+ * @brief Check the tick resolution of a configuration
+ *
+ * @param PWM_config is the configuration to check
+ *
+ * @return 1 if the tick resolution is valid, 0 otherwise.
+ */
+static uint8_t PWM_check_tick_resolution(PWM_config_info *PWM_config);
+
+/**
+ * @brief Wait the dead time, counted on the PWM PIT timer
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_wait_dead_time(PWM_group_info *group);
+
+/**
+ * @brief Compute the PWM period in PIT counts closest to a frequency
+ *
+ * @param frequency is the target PWM frequency in Hz
+ * @param achieved_frequency is the address to store the PWM frequency really obtained, it may be NULL
+ *
+ * @return the PWM period in PIT counts, 0 if the frequency is out of range.
+ */
+static uint32_t PWM_frequency_to_counts(uint32_t frequency, uint32_t *achieved_frequency);
+
+/**
+ * @brief Switch to the pending period and resolution at a period rollover
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_apply_timing(PWM_group_info *group);
+
+/**
+ * @brief Load the PIT with the length of one duty step of tick mode
+ *
+ * @param group is the PWM group
+ * @param period_counts is the PWM period in PIT counts
+ * @param resolution is the number of duty steps per period
+ *
+ * @return: This function return nothing.
+ */
+static void PWM_set_tick_load(PWM_group_info *group, uint32_t period_counts, uint32_t resolution);
+
+/**
+ * @brief Take the duty of every channel for a new period, with sigma-delta dithering
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_dither_period(PWM_group_info *group);
+
+/**
+ * @brief Sigma-delta step of the duty of one channel
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ *
+ * @return the whole duty steps of the channel in the new period.
+ */
+static uint32_t PWM_dither_channel(PWM_group_info *group, uint8_t channel);
+
+/**
+ * @brief Take the duty of every channel for a new period, the sub-step bits move the pulse ends
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_refine_period(PWM_group_info *group);
+
+/**
+ * @brief Compute the change of the length of a duty step made by the moved pulse ends
+ *
+ * @param group is the PWM group
+ * @param step is the index of the duty step
+ *
+ * @return the change of the step length in PIT counts.
+ */
+static int32_t PWM_step_offset(PWM_group_info *group, uint32_t step);
+
+/**
+ * @brief Latch the shadow duty and fade request of a channel
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_fade_latch(PWM_group_info *group, uint8_t channel);
+
+/**
+ * @brief Move every running fade by one period
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_fade_period(PWM_group_info *group);
+
+/**
+ * @brief Map the elapsed part of a fade to the part of its duty change
+ *
+ * @param curve is the easing curve
+ * @param progress is the elapsed part of the fade, 16 fractional bits
+ * @param falling is 1 if the duty goes down
+ *
+ * @return the part of the duty change, 16 fractional bits.
+ */
+static uint32_t PWM_fade_ease(uint8_t curve, uint32_t progress, uint8_t falling);
+
+/**
+ * @brief Latch the shadow duty registers and the pending timing at a period rollover
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_period_rollover(PWM_group_info *group);
+
+/**
+ * @brief Add the switching of one channel to an edge
+ *
+ * @param group is the PWM group
+ * @param edge is the edge to update
+ * @param channel is the index of the channel
+ * @param level is the logic level of the PWM pulse after the edge (0/1)
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_add_channel_to_edge(PWM_group_info *group, PWM_edge_info *edge, uint8_t channel, uint8_t level);
+
+/**
+ * @brief Find the TPM prescaler and modulo of a PWM period
+ *
+ * @param period_counts is the PWM period in PIT counts
+ * @param prescaler is the address to store the TPM prescaler
+ * @param modulo is the address to store the TPM modulo
+ *
+ * @return 1 if the period fits in a TPM counter, 0 otherwise.
+ */
+static uint8_t PWM_TPM_timing(uint32_t period_counts, uint8_t *prescaler, uint16_t *modulo);
+
+/**
+ * @brief Route the channels with a TPM pin to their TPM channel and start the TPM modules
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_setup_hardware(PWM_group_info *group);
+
+/**
+ * @brief Write the duty of a hardware channel to its TPM match value
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_write_hardware_duty(PWM_group_info *group, uint8_t channel);
+
+/**
+ * @brief Add or remove the pattern marks of a channel in the pattern buffers
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ * @param duty is the on time in duty steps
+ * @param mark is 1 to add the marks, 0 to remove them
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_mark_channel(PWM_group_info *group, uint8_t channel, uint32_t duty, uint8_t mark);
+
+/**
+ * @brief Remove every mark of the pattern buffers
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_clear_pattern(PWM_group_info *group);
+
+/**
+ * @brief Move the tick table marks of the channels whose duty changed
+ *
+ * @param group is the PWM group
+ *
+ * @return the channels whose marks moved, bit n for channel n.
+ */
+static uint32_t PWM_update_pattern(PWM_group_info *group);
+
+/**
+ * @brief Get the last duty step written to the port by the DMA
+ *
+ * @param group is the PWM group
+ *
+ * @return the duty step index inside the period.
+ */
+static uint32_t PWM_DMA_current_step(PWM_group_info *group);
+
+/**
+ * @brief Get the level of the PWM pulse of a channel at a duty step of the period
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ * @param step is the duty step index inside the period
+ *
+ * @return 1 if the PWM pulse is on high logic level, 0 otherwise.
+ */
+static uint8_t PWM_step_level(PWM_group_info *group, uint8_t channel, uint32_t step);
+
+/**
+ * @brief Rewrite the DMA pattern of a channel with its shadow duty
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_DMA_write_duty(PWM_group_info *group, uint8_t channel);
+
+/**
+ * @brief Start the DMA channels which stream the pattern and the PIT timer which paces them
+ *
+ * @param group is the PWM group
+ * @param PIT_config is the PIT configuration of the PWM timer
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_DMA_start(PWM_group_info *group, PIT_config_info *PIT_config);
+
+/**
+ * @brief DMA interrupt of a group, reload the byte counts before the transfer stops
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_DMA_IRQ(PWM_group_info *group);
+
+/**
+ * @brief DMA callback of DMA channel 0, it runs the group of PIT timer 0
+ *
+ * @param: This function has no parameter.
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_DMA0_IRQ(void);
+
+/**
+ * @brief DMA callback of DMA channel 1, it runs the group of PIT timer 1
+ *
+ * @param: This function has no parameter.
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_DMA1_IRQ(void);
+
+/**
+ * @brief Compute the pulse start of every channel from the phase mode
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_compute_phases(PWM_group_info *group);
+
+/**
+ * @brief Get the duty step where the pulse of a channel turns on
+ *
+ * @param group is the PWM group
+ * @param channel is the index of the channel in the configuration
+ * @param duty is the on time in duty steps (0 to resolution)
+ *
+ * @return the duty step index inside the period.
+ */
+static uint32_t PWM_start_step(PWM_group_info *group, uint8_t channel, uint32_t duty);
+
+/**
+ * @brief Move an edge time closer to the period start or end than the ISR can handle to time 0
+ *
+ * @param group is the PWM group
+ * @param time is the edge time in PIT counts, it may be up to two periods
+ *
+ * @return the edge time inside the period.
+ */
+static uint32_t PWM_wrap_edge_time(PWM_group_info *group, uint32_t time);
+
+/**
+ * @brief Find the edge at a time in a sorted edge table, insert it if there is none
+ *
+ * @param table is the edge table, its first edge is at time 0
+ * @param count is the address of the number of edges in the table
+ * @param time is the edge time, an edge closer than PWM_MIN_EDGE_COUNTS is reused
+ *
+ * @return the address of the edge.
+ */
+static PWM_edge_info *PWM_find_edge(PWM_edge_info *table, uint8_t *count, uint32_t time);
+
+/**
+ * @brief Build the sorted edge table of one period from the requested duties
+ *
+ * @param group is the PWM group
+ * @param table is the edge table to build
+ *
+ * @return the number of edges in the table.
+ */
+static uint8_t PWM_build_edge_table(PWM_group_info *group, PWM_edge_info *table);
+
+/**
+ * @brief Build the bit-angle modulation table, one slot per duty bit
+ *
+ * @param group is the PWM group
+ * @param table is the edge table to build
+ *
+ * @return the number of slots in the table.
+ */
+static uint8_t PWM_build_bam_table(PWM_group_info *group, PWM_edge_info *table);
+
+/**
+ * @brief Find the longest interval of the running table, it takes the period change
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_spread_table(PWM_group_info *group);
+
+/**
+ * @brief Pick the period change of a new period
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_spread_period(PWM_group_info *group);
+
+/**
+ * @brief Get the edge which follows the one already loaded in the PIT
+ *
+ * @param group is the PWM group
+ * @param interval is the address to store the time from this edge to the next one
+ *
+ * @return the address of the edge.
+ */
+static PWM_edge_info *PWM_next_edge(PWM_group_info *group, uint32_t *interval);
+
+/**
+ * @brief Drive every pin switching at an edge, one write per port
+ *
+ * @param group is the PWM group
+ * @param edge is the edge to output
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_apply_edge(PWM_group_info *group, PWM_edge_info *edge);
+
+/**
+ * @brief Write the pins of some channels
+ *
+ * @param group is the PWM group
+ * @param channels has bit n set if the pin of channel n is written
+ * @param levels has bit n set if channel n is on high logic level
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_write_pins(PWM_group_info *group, uint32_t channels, uint32_t levels);
+
+/**
+ * @brief Write the pins of the channels whose level changed
+ *
+ * @param group is the PWM group
+ * @param levels has bit n set if channel n is on high logic level
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_write_levels(PWM_group_info *group, uint32_t levels);
+
+#ifdef PWM_JITTER_MEASUREMENT
+/**
+ * @brief Record how late the output is written after the edge
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_record_jitter(PWM_group_info *group);
+#endif
+
+/**
+ * @brief PIT interrupt of a tick mode group, called once per duty step
+ *
+ * @param context is the PWM group registered with the callback
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_tick_IRQ(void *context);
+
+/**
+ * @brief PIT interrupt of an edge mode group, called once per distinct edge time
+ *
+ * @param context is the PWM group registered with the callback
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_edge_IRQ(void *context);
+
+/**
+ * @brief Check if every software channel is held at 0% or 100%
+ *
+ * @param group is the PWM group
+ *
+ * @return 1 if no software pin moves in the period, 0 otherwise.
+ */
+static uint8_t PWM_is_static(PWM_group_info *group);
+
+/**
+ * @brief Start the PIT timer of the software channels from a period start
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_start_timer(PWM_group_info *group);
+
+/**
+ * @brief Restart the PIT timer if it was stopped on a static output
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_resume(PWM_group_info *group);
+
+/**
+ * @brief Stop a running group before it is initialized again
+ *
+ * @param group is the PWM group
+ *
+ * @return: this function return nothing.
+ */
+static void PWM_stop_group(PWM_group_info *group);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_duty_to_counts
+* Description: Convert duty steps to PIT counts
+*
+END***************************************************************************/
+static uint32_t PWM_duty_to_counts(PWM_group_info *group, uint32_t duty)
+{
+    /*No division in the interrupt, counts_per_step is computed with the timing*/
+    return (uint32_t)(((uint64_t)duty * group->counts_per_step) >> 16);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_count_bam_bits
+* Description: Count the duty bits of a BAM resolution
+*
+END***************************************************************************/
+static uint8_t PWM_count_bam_bits(uint32_t resolution)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    while ((ret_val < PWM_BAM_MAX_BITS) && (((1u << ret_val) - 1u) < resolution))
+    {
+        ret_val++;
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_check_timing
+* Description: Check a PWM timing against the ISR budget
+*
+END***************************************************************************/
+static PWM_status_enum_t PWM_check_timing(PWM_mode_type_enum_t mode, uint32_t period_counts,
+                                          uint32_t resolution, uint8_t dither_bits)
+{
+    PWM_status_enum_t ret_val = PWM_STATUS_OK;  /*This variable stores the return value of the function*/
+
+    if ((0 == resolution) || (resolution > period_counts) || (dither_bits > PWM_MAX_DITHER_BITS) ||
+        (((uint64_t)resolution << dither_bits) > 0xFFFFFFFFu))
+    {
+        ret_val = PWM_STATUS_INVALID;
+    }
+    /*BAM resolution is (2^N - 1) steps*/
+    else if ((PWM_BAM_MODE == mode) && (((1u << PWM_count_bam_bits(resolution)) - 1u) != resolution))
+    {
+        ret_val = PWM_STATUS_INVALID;
+    }
+    /*DMA pattern is a power of two steps which fits the buffers, the DMA has no dithering*/
+    else if ((PWM_DMA_MODE == mode) && ((resolution < PWM_DMA_MIN_STEPS) || (resolution > PWM_DMA_MAX_STEPS) ||
+                                        (0 != (resolution & (resolution - 1u))) || (0 != dither_bits)))
+    {
+        ret_val = PWM_STATUS_INVALID;
+    }
+    /*DMA moves a set and a clear mask per duty step*/
+    else if ((PWM_DMA_MODE == mode) && ((period_counts / resolution) < PWM_DMA_MIN_TICK_COUNTS))
+    {
+        ret_val = PWM_STATUS_ISR_BUDGET;
+    }
+    /*Tick and BAM mode interrupt after every duty step or the shortest slot*/
+    else if (((PWM_TICK_MODE == mode) || (PWM_BAM_MODE == mode)) &&
+             ((period_counts / resolution) < PWM_MIN_EDGE_COUNTS))
+    {
+        ret_val = PWM_STATUS_ISR_BUDGET;
+    }
+    /*Edge and BAM times are built from the step length with 16 fractional bits*/
+    else if (((PWM_EDGE_MODE == mode) || (PWM_BAM_MODE == mode)) &&
+             ((period_counts / resolution) > PWM_MAX_STEP_COUNTS))
+    {
+        ret_val = PWM_STATUS_INVALID;
+    }
+    /*Edge mode needs room for the on and off time*/
+    else if (period_counts < (2u * PWM_MIN_EDGE_COUNTS))
+    {
+        ret_val = PWM_STATUS_ISR_BUDGET;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_check_ports
+* Description: The DMA writes the masks of a single port, the tick table
+*              has a word per duty step and port
+*
+END***************************************************************************/
+static uint8_t PWM_check_ports(PWM_config_info *PWM_config)
+{
+    uint8_t ret_val = 1;    /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+    uint8_t ports_used = 0; /*Bit n set if port n contains a channel*/
+    uint8_t count = 0;      /*Number of ports which contain a channel*/
+
+    if ((PWM_TICK_MODE == PWM_config->mode) && (PWM_TICK_TABLE == PWM_config->tick_output))
+    {
+        for (channel = 0; channel < PWM_config->channel_count; channel++)
+        {
+            if (0 == (ports_used & (1u << (uint8_t)PWM_config->channels[channel].port_type)))
+            {
+                ports_used |= 1u << (uint8_t)PWM_config->channels[channel].port_type;
+                count++;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        ret_val = (uint8_t)((PWM_config->resolution * count) <= PWM_TICK_TABLE_MAX_ENTRIES);
+    }
+    else if (PWM_DMA_MODE == PWM_config->mode)
+    {
+        for (channel = 1; channel < PWM_config->channel_count; channel++)
+        {
+            if (PWM_config->channels[channel].port_type != PWM_config->channels[0].port_type)
+            {
+                ret_val = 0;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_check_pairs
+* Description: A low side needs a high side before it, the DMA pattern and
+*              the tick table have no dead time
+*
+END***************************************************************************/
+static uint8_t PWM_check_pairs(PWM_config_info *PWM_config)
+{
+    uint8_t ret_val = 1;    /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < PWM_config->channel_count; channel++)
+    {
+        if ((PWM_PAIR_LOW_SIDE == PWM_config->channels[channel].pair) &&
+            ((0 == channel) || (PWM_PAIR_LOW_SIDE == PWM_config->channels[channel - 1u].pair) ||
+             (PWM_DMA_MODE == PWM_config->mode) ||
+             ((PWM_TICK_MODE == PWM_config->mode) && (PWM_TICK_TABLE == PWM_config->tick_output))))
+        {
+            ret_val = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_check_timebase
+* Description: A chained timebase takes PIT0 as its prescaler, PIT0 can
+*              only run a group which writes no pin from the PIT
+*
+END***************************************************************************/
+static uint8_t PWM_check_timebase(PWM_config_info *PWM_config)
+{
+    uint8_t ret_val = 1;    /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    if (PWM_TIMEBASE_BUS == PWM_config->timebase)
+    {
+        /*PIT0 is busy as the prescaler of the chained group*/
+        if ((PWM_CHAIN_TIMER != PWM_config->timer_index) &&
+            (PWM_TIMEBASE_CHAINED == PWM_groups[PWM_CHAIN_TIMER].PWM_active_config.timebase) &&
+            (0 != PWM_groups[PWM_CHAIN_TIMER].port_count))
+        {
+            ret_val = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    /*Only the edge interrupt keeps the long counts, the dead time is waited in bus clock cycles*/
+    else if ((PWM_TIMEBASE_CHAINED == PWM_config->timebase) && (PWM_CHAIN_TIMER == PWM_config->timer_index) &&
+             (0 != PWM_config->chain_prescaler) && (0 == PWM_groups[0].port_count) &&
+             ((PWM_EDGE_MODE == PWM_config->mode) || (PWM_BAM_MODE == PWM_config->mode)))
+    {
+        for (channel = 0; channel < PWM_config->channel_count; channel++)
+        {
+            if (PWM_PAIR_LOW_SIDE == PWM_config->channels[channel].pair)
+            {
+                ret_val = 0;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        ret_val = 0;
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_check_tick_resolution
+* Description: A refined tick moves only the pulse ends, so every pulse must
+*              start at the period start
+*
+END***************************************************************************/
+static uint8_t PWM_check_tick_resolution(PWM_config_info *PWM_config)
+{
+    uint8_t ret_val = 1;    /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    if (PWM_config->tick_resolution > PWM_TICK_REFINED)
+    {
+        ret_val = 0;
+    }
+    else if ((PWM_TICK_MODE == PWM_config->mode) && (PWM_TICK_REFINED == PWM_config->tick_resolution))
+    {
+        if (PWM_PHASE_ALIGNED != PWM_config->phase_mode)
+        {
+            ret_val = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        for (channel = 0; channel < PWM_config->channel_count; channel++)
+        {
+            if (PWM_ALIGN_CENTER == PWM_config->channels[channel].alignment)
+            {
+                ret_val = 0;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_dead_time_to_counts
+* Description: A dead time in nanoseconds is rounded up to the next PIT count
+*
+END***************************************************************************/
+static uint32_t PWM_dead_time_to_counts(PWM_config_info *PWM_config)
+{
+    uint32_t ret_val = PWM_config->dead_time;   /*This variable stores the return value of the function*/
+
+    if (PWM_DEAD_TIME_NS == PWM_config->dead_time_unit)
+    {
+        ret_val = (uint32_t)((((uint64_t)PWM_config->dead_time * Driver_SIM_get_bus_clock()) + 999999999u) /
+                             1000000000u);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_wait_dead_time
+* Description: Add up the counts of the PIT between two reads. After a reload
+*              only the counts down to 0 are sure, and a read takes at least
+*              one bus clock, so the wait is never short, even before the
+*              timer is started.
+*
+END***************************************************************************/
+static void PWM_wait_dead_time(PWM_group_info *group)
+{
+    uint32_t elapsed = 0;   /*PIT counts elapsed since the pins turned off*/
+    uint32_t previous = Driver_PIT_read_current_value_fast(group->PWM_active_config.timer_index);  /*Last timer value*/
+    uint32_t current = 0;   /*Timer value*/
+
+    while (elapsed < group->dead_counts)
+    {
+        current = Driver_PIT_read_current_value_fast(group->PWM_active_config.timer_index);
+
+        if (current == previous)
+        {
+            elapsed++;
+        }
+        else if (current < previous)
+        {
+            elapsed += previous - current;
+        }
+        else
+        {
+            elapsed += previous + 1u;
+        }
+
+        previous = current;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_frequency_to_counts
+* Description: Round the bus clock period of a frequency to PIT counts
+*
+END***************************************************************************/
+static uint32_t PWM_frequency_to_counts(uint32_t frequency, uint32_t *achieved_frequency)
+{
+    PIT_rate_info rate = {0, 0, 0, 0, 0, 0};    /*Load value of the frequency*/
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (1 == Driver_PIT_calculate_rate(frequency, Driver_SIM_get_bus_clock(), &rate))
+    {
+        /*The period lasts one count more than the load value*/
+        ret_val = rate.load_value + 1u;
+
+        if (NULL != achieved_frequency)
+        {
+            *achieved_frequency = rate.achieved_frequency;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_apply_timing
+* Description: Switch to the new period and rescale the duties
+*
+END***************************************************************************/
+static void PWM_apply_timing(PWM_group_info *group)
+{
+    uint8_t channel = 0;    /*Channel index*/
+    uint32_t old_resolution = group->PWM_active_config.resolution;    /*Resolution the duties are given in*/
+
+    group->PWM_active_config.period_counts = group->pending_period_counts;
+    group->PWM_active_config.resolution = group->pending_resolution;
+    group->bam_bits = PWM_count_bam_bits(group->pending_resolution);
+    group->counts_per_step = (uint32_t)(((uint64_t)group->pending_period_counts << 16) / group->pending_resolution);
+    group->spread_counts = (uint32_t)(((uint64_t)group->pending_period_counts *
+                                       group->PWM_active_config.spread_permille) / 1000u);
+
+    /*The foreground is not inside an update, the shadow registers can be rescaled too*/
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        group->shadow_duty[channel] = (uint32_t)(((uint64_t)group->shadow_duty[channel] * group->pending_resolution) /
+                                                 old_resolution);
+        group->latched_duty[channel] = (uint32_t)(((uint64_t)group->latched_duty[channel] * group->pending_resolution) /
+                                                  old_resolution);
+        group->fade_target[channel] = (uint32_t)(((uint64_t)group->fade_target[channel] * group->pending_resolution) /
+                                                 old_resolution);
+        group->fade_start[channel] = (uint32_t)(((uint64_t)group->fade_start[channel] * group->pending_resolution) /
+                                                old_resolution);
+        group->active_duty[channel] = (uint32_t)(((uint64_t)group->active_duty[channel] * group->pending_resolution) /
+                                                 old_resolution);
+        group->active_on_counts[channel] = PWM_duty_to_counts(group, group->active_duty[channel]);
+        group->phase_steps[channel] = (uint32_t)(((uint64_t)group->phase_steps[channel] * group->pending_resolution) /
+                                                 old_resolution);
+    }
+
+    PWM_compute_phases(group);
+
+    /*Every mark moves, the whole table is written again*/
+    if (1 == group->tick_table)
+    {
+        PWM_clear_pattern(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*Tick mode interrupts and DMA mode transfers once per new duty step*/
+    if (PWM_TICK_MODE == group->PWM_active_config.mode)
+    {
+        PWM_set_tick_load(group, group->pending_period_counts, group->pending_resolution);
+    }
+    else if (PWM_DMA_MODE == group->PWM_active_config.mode)
+    {
+        Driver_PIT_set_load_value(group->PWM_active_config.timer_index,
+                                  (group->pending_period_counts / group->pending_resolution) - 1u);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    group->table_dirty = 1;
+    group->timing_pending = 0;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_set_tick_load
+* Description: Load the PIT with the whole or the fractional step length
+*
+END***************************************************************************/
+static void PWM_set_tick_load(PWM_group_info *group, uint32_t period_counts, uint32_t resolution)
+{
+    uint32_t step_counts = period_counts / resolution;  /*Whole part of the step length*/
+    uint16_t fraction = 0;  /*Fractional part of the step length, 16 fractional bits*/
+
+    /*The remainder of the period is spread over the steps*/
+    if (PWM_TICK_WHOLE != group->PWM_active_config.tick_resolution)
+    {
+        fraction = (uint16_t)((((uint64_t)(period_counts % resolution)) << 16) / resolution);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*The moved pulse ends of the old steps are dropped, the next rollover moves them again*/
+    group->tick_fraction = fraction;
+    group->tick_load_offset = 0;
+    group->refine_count = 0;
+
+    Driver_PIT_set_fractional_load_value(group->PWM_active_config.timer_index, step_counts - 1u, fraction);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_dither_period
+* Description: First order sigma-delta on the sub-step bits of each duty
+*
+END***************************************************************************/
+static void PWM_dither_period(PWM_group_info *group)
+{
+    uint8_t channel = 0;    /*Channel index*/
+    uint32_t duty = 0;      /*Whole duty steps output in this period*/
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        duty = PWM_dither_channel(group, channel);
+
+        if (duty != group->active_duty[channel])
+        {
+            group->active_duty[channel] = duty;
+            group->active_on_counts[channel] = PWM_duty_to_counts(group, duty);
+            group->table_dirty = 1;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_dither_channel
+* Description: Add the sub-step bits to the remainder, its carry is one more
+*              duty step in this period
+*
+END***************************************************************************/
+static uint32_t PWM_dither_channel(PWM_group_info *group, uint8_t channel)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+    uint32_t fraction_mask = (1u << group->PWM_active_config.dither_bits) - 1u;    /*Sub-step bits of a duty*/
+    uint32_t accumulator = 0;   /*Remainder of the previous periods plus the new sub-step part*/
+
+    accumulator = group->dither_error[channel] + (group->latched_duty[channel] & fraction_mask);
+    ret_val = (group->latched_duty[channel] >> group->PWM_active_config.dither_bits) +
+              (accumulator >> group->PWM_active_config.dither_bits);
+    group->dither_error[channel] = accumulator & fraction_mask;
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_refine_period
+* Description: The duty is rounded to whole steps and the rest moves the end
+*              of the pulse by PIT counts: the step before it is longer and
+*              the step after it shorter by the same counts. The fraction of
+*              a count is carried over, so that step alternates between two
+*              lengths across the periods. A pulse ending in the first steps,
+*              at a rail or next to a moved end is dithered by whole steps,
+*              pulses ending in the same step share its move.
+*
+END***************************************************************************/
+static void PWM_refine_period(PWM_group_info *group)
+{
+    uint8_t channel = 0;        /*Channel index*/
+    uint8_t entry = 0;          /*Index of a moved pulse end*/
+    uint8_t shared = 0;         /*A lower channel moves the same pulse end*/
+    uint8_t blocked = 0;        /*A lower channel moves the end of the step before or after*/
+    uint8_t bits = group->PWM_active_config.dither_bits;   /*Sub-step bits of a duty*/
+    uint32_t fraction_mask = (1u << bits) - 1u;             /*Sub-step bits of a duty*/
+    uint32_t bias = (group->counts_per_step >> 17) + 1u;    /*Whole counts keeping the move positive*/
+    uint32_t duty = 0;          /*Whole duty steps output in this period*/
+    uint32_t accumulator = 0;   /*Remainder of the previous periods plus the new fraction of a count*/
+    uint64_t move = 0;          /*Move of the pulse end plus the bias, 16 fractional bits*/
+
+    group->refine_count = 0;
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        duty = (uint32_t)(((uint64_t)group->latched_duty[channel] + (1u << (bits - 1u))) >> bits);
+        shared = 0;
+        blocked = 0;
+
+        for (entry = 0; entry < group->refine_count; entry++)
+        {
+            if (group->refine_step[entry] == duty)
+            {
+                shared = 1;
+            }
+            else if (((group->refine_step[entry] + 1u) == duty) || ((duty + 1u) == group->refine_step[entry]))
+            {
+                blocked = 1;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        /*A hardware channel or a low side has no edge in the tick interrupt*/
+        if ((duty < PWM_REFINE_FIRST_STEP) || (duty >= group->PWM_active_config.resolution) || (1 == blocked) ||
+            (0 != (group->hardware_channels & (1u << channel))) ||
+            (PWM_PAIR_LOW_SIDE == group->channel_config[channel].pair))
+        {
+            duty = PWM_dither_channel(group, channel);
+        }
+        else if (0 == shared)
+        {
+            /*Exact end of the pulse minus the end of its whole steps*/
+            move = ((uint64_t)(group->latched_duty[channel] >> bits) * group->counts_per_step) +
+                   (((uint64_t)(group->latched_duty[channel] & fraction_mask) * group->counts_per_step) >> bits) +
+                   ((uint64_t)bias << 16) - ((uint64_t)duty * group->counts_per_step);
+            accumulator = (uint32_t)group->refine_error[channel] + (uint32_t)(move & 0xFFFFu);
+            group->refine_error[channel] = (uint16_t)accumulator;
+            group->refine_step[group->refine_count] = duty;
+            group->refine_offset[group->refine_count] = (int32_t)((uint32_t)(move >> 16) + (accumulator >> 16)) -
+                                                        (int32_t)bias;
+            group->refine_count++;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        if (duty != group->active_duty[channel])
+        {
+            group->active_duty[channel] = duty;
+            group->active_on_counts[channel] = PWM_duty_to_counts(group, duty);
+            group->table_dirty = 1;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_step_offset
+* Description: A moved end of the step makes it longer, a moved start
+*              makes it shorter
+*
+END***************************************************************************/
+static int32_t PWM_step_offset(PWM_group_info *group, uint32_t step)
+{
+    int32_t ret_val = 0;    /*This variable stores the return value of the function*/
+    uint8_t entry = 0;      /*Index of a moved pulse end*/
+
+    for (entry = 0; entry < group->refine_count; entry++)
+    {
+        if (group->refine_step[entry] == (step + 1u))
+        {
+            ret_val += group->refine_offset[entry];
+        }
+        else if (group->refine_step[entry] == step)
+        {
+            ret_val -= group->refine_offset[entry];
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_fade_latch
+* Description: A request written again is the same fade, it keeps running.
+*              A new one starts from the duty the channel has now.
+*
+END***************************************************************************/
+static void PWM_fade_latch(PWM_group_info *group, uint8_t channel)
+{
+    if ((group->shadow_duty[channel] != group->fade_target[channel]) ||
+        (group->shadow_fade_periods[channel] != group->fade_periods[channel]) ||
+        (group->shadow_fade_curve[channel] != group->fade_curve[channel]))
+    {
+        group->fade_target[channel] = group->shadow_duty[channel];
+        group->fade_periods[channel] = group->shadow_fade_periods[channel];
+        group->fade_curve[channel] = group->shadow_fade_curve[channel];
+        group->fade_step[channel] = group->shadow_fade_step[channel];
+        group->fade_start[channel] = group->latched_duty[channel];
+        group->fade_progress[channel] = 0;
+        group->fade_left[channel] = group->fade_periods[channel];
+
+        /*Without fade the duty is output from this period*/
+        if (0 == group->fade_left[channel])
+        {
+            group->latched_duty[channel] = group->fade_target[channel];
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_fade_period
+* Description: The progress steps were computed with the request, a period
+*              only adds and multiplies
+*
+END***************************************************************************/
+static void PWM_fade_period(PWM_group_info *group)
+{
+    uint8_t channel = 0;    /*Channel index*/
+    uint32_t part = 0;      /*Part of the duty change reached, 16 fractional bits*/
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if (0 != group->fade_left[channel])
+        {
+            group->fade_left[channel]--;
+            group->fade_progress[channel] += group->fade_step[channel];
+
+            /*The last period lands on the target whatever the rounding*/
+            if (0 == group->fade_left[channel])
+            {
+                group->latched_duty[channel] = group->fade_target[channel];
+            }
+            else if (group->fade_target[channel] >= group->fade_start[channel])
+            {
+                part = PWM_fade_ease(group->fade_curve[channel], group->fade_progress[channel] >> 16, 0);
+                group->latched_duty[channel] = group->fade_start[channel] +
+                                               (uint32_t)(((uint64_t)(group->fade_target[channel] -
+                                                                      group->fade_start[channel]) * part) >> 16);
+            }
+            else
+            {
+                part = PWM_fade_ease(group->fade_curve[channel], group->fade_progress[channel] >> 16, 1);
+                group->latched_duty[channel] = group->fade_start[channel] -
+                                               (uint32_t)(((uint64_t)(group->fade_start[channel] -
+                                                                      group->fade_target[channel]) * part) >> 16);
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_fade_ease
+* Description: Linear, smoothstep 3p^2 - 2p^3, or (2^(8p) - 1) / 255. A
+*              falling exponential fade is the rising one played backwards,
+*              the duty drops by the same ratio every period.
+*
+END***************************************************************************/
+static uint32_t PWM_fade_ease(uint8_t curve, uint32_t progress, uint8_t falling)
+{
+    uint32_t ret_val = progress;    /*This variable stores the return value of the function*/
+    uint32_t square = 0;            /*progress^2, 16 fractional bits*/
+    uint32_t exponent = 0;          /*Exponent of the power of two, 16 fractional bits*/
+    uint32_t index = 0;             /*Entry of the 2^(n/16) table*/
+    uint32_t power = 0;             /*2^exponent, 16 fractional bits*/
+
+    if (PWM_FADE_S_CURVE == curve)
+    {
+        square = (progress * progress) >> 16;
+        ret_val = (uint32_t)(((uint64_t)square * ((3u << 16) - (2u * progress))) >> 16);
+    }
+    else if (PWM_FADE_EXPONENTIAL == curve)
+    {
+        exponent = ((1 == falling) ? (0x10000u - progress) : progress) * PWM_FADE_EXP_OCTAVES;
+        index = (exponent >> 12) & 0xFu;
+
+        /*Linear interpolation inside the table, then the whole octaves*/
+        power = PWM_exp2_table[index] +
+                (((PWM_exp2_table[index + 1u] - PWM_exp2_table[index]) * (exponent & 0xFFFu)) >> 12);
+        power <<= exponent >> 16;
+
+        /*257 / 65536 is 1 / 255 within 0.002%*/
+        ret_val = (uint32_t)(((uint64_t)(power - 0x10000u) * 257u) >> 16);
+        ret_val = (1 == falling) ? (0x10000u - ret_val) : ret_val;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_period_rollover
+* Description: Take the shadow duty registers and the pending timing. The
+*              foreground makes the sequence odd while it writes, then the
+*              registers are left for the next rollover.
+*
+END***************************************************************************/
+static void PWM_period_rollover(PWM_group_info *group)
+{
+    uint32_t sequence = group->shadow_sequence;    /*Sequence of the shadow registers*/
+    uint8_t channel = 0;                    /*Channel index*/
+
+    /*The shadow registers are consistent only when the sequence is even*/
+    if (0 == (sequence & 1u))
+    {
+        if (0 != group->timing_pending)
+        {
+            PWM_apply_timing(group);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        if (sequence != group->latched_sequence)
+        {
+            for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+            {
+                PWM_fade_latch(group, channel);
+            }
+
+            group->latched_sequence = sequence;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    PWM_fade_period(group);
+
+    /*A pulse end moves by PIT counts only if the steps around it stay over the interrupt budget*/
+    if ((PWM_TICK_MODE == group->PWM_active_config.mode) &&
+        (PWM_TICK_REFINED == group->PWM_active_config.tick_resolution) &&
+        (0 != group->PWM_active_config.dither_bits) &&
+        ((group->counts_per_step >> 16) >= PWM_REFINE_MIN_STEP_COUNTS))
+    {
+        PWM_refine_period(group);
+    }
+    else if (0 != group->PWM_active_config.dither_bits)
+    {
+        PWM_dither_period(group);
+    }
+    else
+    {
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            if (group->latched_duty[channel] != group->active_duty[channel])
+            {
+                group->active_duty[channel] = group->latched_duty[channel];
+                group->active_on_counts[channel] = PWM_duty_to_counts(group, group->active_duty[channel]);
+                group->table_dirty = 1;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_TPM_timing
+* Description: Convert the PWM period to TPM counts and pick the smallest
+*              prescaler which keeps it in the 16-bit counter
+*
+END***************************************************************************/
+static uint8_t PWM_TPM_timing(uint32_t period_counts, uint8_t *prescaler, uint16_t *modulo)
+{
+    uint8_t ret_val = 0;        /*This variable stores the return value of the function*/
+    uint64_t TPM_counts = 0;    /*PWM period in TPM clock cycles*/
+    uint8_t shift = 0;          /*Prescaler exponent*/
+    uint32_t bus_clock = Driver_SIM_get_bus_clock();    /*Clock of the PIT counts*/
+
+    TPM_counts = ((uint64_t)period_counts * Driver_SIM_get_TPM_clock() + (bus_clock / 2u)) / bus_clock;
+
+    while ((shift < TPM_MAX_PRESCALER) && ((TPM_counts >> shift) > ((uint64_t)TPM_MAX_MODULO + 1u)))
+    {
+        shift++;
+    }
+
+    /*The counter needs at least two counts to make a pulse*/
+    if (((TPM_counts >> shift) <= ((uint64_t)TPM_MAX_MODULO + 1u)) && ((TPM_counts >> shift) >= 2u))
+    {
+        *prescaler = shift;
+        *modulo = (uint16_t)((TPM_counts >> shift) - 1u);
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_setup_hardware
+* Description: Give each TPM channel to the first PWM channel on one of its
+*              pins, the other channels stay on the PIT engine
+*
+END***************************************************************************/
+static void PWM_setup_hardware(PWM_group_info *group)
+{
+    uint8_t channel = 0;            /*Channel index*/
+    uint8_t other = 0;              /*Index of a channel already routed*/
+    uint8_t TPM_index = 0;          /*TPM module index*/
+    uint8_t route_free = 0;         /*The TPM channel drives no other PWM channel*/
+    uint8_t TPM_busy = 0;           /*Bit n set if TPM n runs the period of the other group*/
+    uint8_t index = 0;              /*Group index*/
+    TPM_channel_mode_enum_t mode = TPM_PWM_HIGH_TRUE;   /*TPM channel mode of the channel*/
+    TPM_config_info TPM_config;     /*TPM module configuration*/
+
+    group->hardware_channels = 0;
+    group->hardware_pending = 0;
+    group->TPM_used = 0;
+    group->hardware_resolution = group->PWM_active_config.resolution;
+
+    for (index = 0; index < PWM_GROUP_COUNT; index++)
+    {
+        if (group != &PWM_groups[index])
+        {
+            TPM_busy |= PWM_groups[index].TPM_used;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    /*A TPM can not count a chained period*/
+    if ((PWM_BACKEND_AUTO == group->PWM_active_config.backend) &&
+        (PWM_TIMEBASE_BUS == group->PWM_active_config.timebase) &&
+        (1 == PWM_TPM_timing(group->PWM_active_config.period_counts, &group->TPM_prescaler, &group->TPM_modulo)))
+    {
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            group->hardware_duty[channel] = 0;
+
+            /*The TPM counts up, it only makes edge aligned pulses without dead time*/
+            if ((PWM_ALIGN_EDGE == group->channel_config[channel].alignment) &&
+                (0 == (group->pair_channels & (1u << channel))) &&
+                (1 == Driver_TPM_find_pin_route(group->channel_config[channel].port_type,
+                                                group->channel_config[channel].pin,
+                                                &group->hardware_route[channel])))
+            {
+                /*A TPM module has a single period, the other group keeps its own*/
+                route_free = (uint8_t)(0 == (TPM_busy & (1u << group->hardware_route[channel].TPM_index)));
+
+                for (other = 0; other < channel; other++)
+                {
+                    if ((0 != (group->hardware_channels & (1u << other))) &&
+                        (group->hardware_route[other].TPM_index == group->hardware_route[channel].TPM_index) &&
+                        (group->hardware_route[other].channel == group->hardware_route[channel].channel))
+                    {
+                        route_free = 0;
+                    }
+                    else
+                    {
+                        /*Do nothing*/
+                    }
+                }
+
+                if (1 == route_free)
+                {
+                    group->hardware_channels |= 1u << channel;
+                    group->TPM_used |= (uint8_t)(1u << group->hardware_route[channel].TPM_index);
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        /*Every TPM module runs the same period*/
+        for (TPM_index = 0; TPM_index < TPM_MODULE_COUNT; TPM_index++)
+        {
+            if (0 != (group->TPM_used & (1u << TPM_index)))
+            {
+                TPM_config.TPM_index = TPM_index;
+                TPM_config.prescaler = group->TPM_prescaler;
+                TPM_config.modulo = group->TPM_modulo;
+                Driver_TPM_init(&TPM_config);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        /*The pin is handed to the TPM once its channel outputs the inactive level*/
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            if (0 != (group->hardware_channels & (1u << channel)))
+            {
+                mode = (HIGH_STATE == group->channel_config[channel].active_state) ? TPM_PWM_HIGH_TRUE :
+                                                                                     TPM_PWM_LOW_TRUE;
+                Driver_TPM_set_channel_value(group->hardware_route[channel].TPM_index,
+                                             group->hardware_route[channel].channel, 0);
+                Driver_TPM_config_channel(group->hardware_route[channel].TPM_index,
+                                          group->hardware_route[channel].channel, mode);
+                Driver_PORT_set_MUX_pin(group->channel_config[channel].port_type, group->channel_config[channel].pin,
+                                        group->hardware_route[channel].mux_type);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_write_hardware_duty
+* Description: Scale the duty to the TPM period, the TPM takes the new match
+*              value at its next counter overflow
+*
+END***************************************************************************/
+static void PWM_write_hardware_duty(PWM_group_info *group, uint8_t channel)
+{
+    uint32_t value = 0; /*TPM match value*/
+
+    value = (uint32_t)(((uint64_t)group->hardware_duty[channel] * ((uint32_t)group->TPM_modulo + 1u)) /
+                       ((uint64_t)group->hardware_resolution << group->PWM_active_config.dither_bits));
+
+    Driver_TPM_set_channel_value(group->hardware_route[channel].TPM_index, group->hardware_route[channel].channel,
+                                 (uint16_t)value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_mark_channel
+* Description: The on mark is at the pulse start and the off mark one duty
+*              later, a pin which is active low has them in the other buffer.
+*              Each duty step has one word per port of port_list.
+*
+END***************************************************************************/
+static void PWM_mark_channel(PWM_group_info *group, uint8_t channel, uint32_t duty, uint8_t mark)
+{
+    uint32_t pin_mask = 1u << group->channel_config[channel].pin;     /*Pin of the channel in its port*/
+    uint8_t slot = group->port_slot[group->channel_config[channel].port_type];   /*Word of the port in a duty step*/
+    uint32_t *on_buffer = group->pattern_set_buffer;       /*Buffer which turns the pulse on*/
+    uint32_t *off_buffer = group->pattern_clear_buffer;    /*Buffer which turns the pulse off*/
+    uint32_t step = 0;                          /*Index of the mark in the buffer*/
+
+    if (LOW_STATE == group->channel_config[channel].active_state)
+    {
+        on_buffer = group->pattern_clear_buffer;
+        off_buffer = group->pattern_set_buffer;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*A 0% pulse never turns on*/
+    if (0 != duty)
+    {
+        step = (PWM_start_step(group, channel, duty) * group->port_count) + slot;
+        on_buffer[step] = (1 == mark) ? (on_buffer[step] | pin_mask) : (on_buffer[step] & ~pin_mask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*A 100% pulse never turns off*/
+    if (duty < group->PWM_active_config.resolution)
+    {
+        step = PWM_start_step(group, channel, duty) + duty;
+
+        if (step >= group->PWM_active_config.resolution)
+        {
+            step -= group->PWM_active_config.resolution;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        step = (step * group->port_count) + slot;
+        off_buffer[step] = (1 == mark) ? (off_buffer[step] | pin_mask) : (off_buffer[step] & ~pin_mask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_clear_pattern
+* Description: Clear the words of every duty step and port
+*
+END***************************************************************************/
+static void PWM_clear_pattern(PWM_group_info *group)
+{
+    uint32_t index = 0;     /*Word index in the buffers*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (index = 0; index < (group->PWM_active_config.resolution * group->port_count); index++)
+    {
+        group->pattern_set_buffer[index] = 0;
+        group->pattern_clear_buffer[index] = 0;
+    }
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        group->pattern_duty[channel] = PWM_PATTERN_UNMARKED;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_update_pattern
+* Description: Only the marks of a changed duty are rewritten, the other
+*              steps of the table are kept
+*
+END***************************************************************************/
+static uint32_t PWM_update_pattern(PWM_group_info *group)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if ((0 == (group->hardware_channels & (1u << channel))) &&
+            (group->pattern_duty[channel] != group->active_duty[channel]))
+        {
+            if (PWM_PATTERN_UNMARKED != group->pattern_duty[channel])
+            {
+                PWM_mark_channel(group, channel, group->pattern_duty[channel], 0);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            PWM_mark_channel(group, channel, group->active_duty[channel], 1);
+            group->pattern_duty[channel] = group->active_duty[channel];
+            ret_val |= 1u << channel;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA_current_step
+* Description: The source address of the triggered channel points to the
+*              set mask of the next duty step
+*
+END***************************************************************************/
+static uint32_t PWM_DMA_current_step(PWM_group_info *group)
+{
+    uint32_t next_step = 0; /*Duty step the DMA writes at the next PIT trigger*/
+
+    next_step = (Driver_DMA_read_source_address(group->PWM_active_config.timer_index) -
+                 (uint32_t)group->pattern_set_buffer) / 4u;
+
+    return (next_step - 1u) & (group->PWM_active_config.resolution - 1u);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_step_level
+* Description: Read the level of a channel from its duty and pulse start
+*
+END***************************************************************************/
+static uint8_t PWM_step_level(PWM_group_info *group, uint8_t channel, uint32_t step)
+{
+    uint32_t position = 0;  /*Duty step index from the pulse start of the channel*/
+    uint32_t start = 0;     /*Duty step where the pulse turns on*/
+
+    start = PWM_start_step(group, channel, group->active_duty[channel]);
+    position = (step >= start) ? (step - start) : (step + group->PWM_active_config.resolution - start);
+
+    return (uint8_t)(position < group->active_duty[channel]);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA_write_duty
+* Description: Move the marks of a channel to its new duty. The DMA may have
+*              passed a removed mark or not reached a new one, so the level
+*              of the step it is in is written until no step elapsed during
+*              the write.
+*
+END***************************************************************************/
+static void PWM_DMA_write_duty(PWM_group_info *group, uint8_t channel)
+{
+    uint32_t duty = group->shadow_duty[channel];   /*New duty of the channel*/
+    uint32_t pin_mask = 1u << group->channel_config[channel].pin; /*Pin of the channel in its port*/
+    uint32_t step = 0;                      /*Last duty step written by the DMA*/
+
+    if (duty != group->active_duty[channel])
+    {
+        PWM_mark_channel(group, channel, group->active_duty[channel], 0);
+        group->active_duty[channel] = duty;
+        PWM_mark_channel(group, channel, duty, 1);
+
+        do
+        {
+            step = PWM_DMA_current_step(group);
+
+            /*Port set and clear registers, the DMA writes the other pins of the port at the same time*/
+            if ((1 == PWM_step_level(group, channel, step)) ==
+                (HIGH_STATE == group->channel_config[channel].active_state))
+            {
+                Driver_GPIO_set_port_pins(group->channel_config[channel].port_type, pin_mask);
+            }
+            else
+            {
+                Driver_GPIO_clear_port_pins(group->channel_config[channel].port_type, pin_mask);
+            }
+        } while (step != PWM_DMA_current_step(group));
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA_start
+* Description: PIT timer n triggers DMA channel n, which writes the set mask
+*              of the step to PSOR, then the linked channel writes the clear
+*              mask to PCOR. Both sources wrap in the pattern buffers.
+*
+END***************************************************************************/
+static void PWM_DMA_start(PWM_group_info *group, PIT_config_info *PIT_config)
+{
+    uint32_t step = 0;          /*Duty step index*/
+    uint8_t channel = 0;        /*Channel index*/
+    uint8_t source_modulo = 0;  /*SMOD value, the buffer is 2^(SMOD + 3) bytes*/
+    uint8_t DMA_ready = 0;      /*The linked channel is configured*/
+    DMA_config_info DMA_config; /*DMA channel configuration*/
+
+    /*DMAMUX configuration info*/
+    DMAMUX_config_info DMAMUX_config = {
+        .channel = group->PWM_active_config.timer_index,
+        .source = DMAMUX_SOURCE_ALWAYS_ENABLED,
+        .trigger = DMAMUX_TRIGGER_ENABLED,
+    };
+
+    PWM_clear_pattern(group);
+
+    /*Every pulse starts at 0%, its off mark keeps the pin inactive*/
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if (0 == (group->hardware_channels & (1u << channel)))
+        {
+            PWM_mark_channel(group, channel, 0, 1);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    /*A buffer of 4 * 2^N bytes needs SMOD = N - 1*/
+    for (step = group->PWM_active_config.resolution; step > 2u; step >>= 1)
+    {
+        source_modulo++;
+    }
+
+    group->DMA_pending = 0;
+
+    DMA_config.size = DMA_SIZE_32BIT;
+    DMA_config.source_increment = 1u;
+    DMA_config.destination_increment = 0u;
+    DMA_config.source_modulo = (DMA_modulo_enum_t)source_modulo;
+
+    /*The linked channel only moves when the triggered one has moved, its larger count never runs out first*/
+    DMA_config.channel = PWM_DMA_LINKED_CHANNEL + group->PWM_active_config.timer_index;
+    DMA_config.source_address = (uint32_t)group->pattern_clear_buffer;
+    DMA_config.destination_address = Driver_GPIO_get_clear_register_address((Port_type_enum_t)group->port_list[0]);
+    DMA_config.byte_count = PWM_DMA_LINKED_BYTE_COUNT;
+    DMA_config.link = DMA_LINK_DISABLED;
+    DMA_config.linked_channel = 0;
+    DMA_config.request_state = DMA_REQUEST_DISABLED;
+    DMA_config.IRQ_state = DMA_IRQ_DISABLED;
+    DMA_ready = Driver_DMA_init(&DMA_config);
+
+    DMA_config.channel = group->PWM_active_config.timer_index;
+    DMA_config.source_address = (uint32_t)group->pattern_set_buffer;
+    DMA_config.destination_address = Driver_GPIO_get_set_register_address((Port_type_enum_t)group->port_list[0]);
+    DMA_config.byte_count = PWM_DMA_BYTE_COUNT;
+    DMA_config.link = DMA_LINK_EACH_TRANSFER;
+    DMA_config.linked_channel = PWM_DMA_LINKED_CHANNEL + group->PWM_active_config.timer_index;
+    DMA_config.request_state = DMA_REQUEST_ENABLED;
+    DMA_config.IRQ_state = DMA_IRQ_ENABLED;
+    Driver_DMA_register_callback(group->PWM_active_config.timer_index,
+                                 (0 == group->PWM_active_config.timer_index) ? PWM_DMA0_IRQ : PWM_DMA1_IRQ);
+
+    /*Without both channels the pins would be set and never cleared, nothing is triggered then*/
+    if ((1 == DMA_ready) && (1 == Driver_DMA_init(&DMA_config)))
+    {
+        Driver_DMAMUX_init(&DMAMUX_config);
+
+        /*The PIT only triggers the DMA, it does not interrupt*/
+        group->running_load = (group->PWM_active_config.period_counts / group->PWM_active_config.resolution) - 1u;
+        PIT_config->load_value = group->running_load;
+        PIT_config->TCTRLn_config.IRQ_state = IRQ_DISABLED;
+        Driver_PIT_init(PIT_config);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA_IRQ
+* Description: The triggered channel moved its whole byte count, give both
+*              channels a new one. The steps triggered before the reload are
+*              lost, the pattern of every channel is delayed the same way.
+*
+END***************************************************************************/
+static void PWM_DMA_IRQ(PWM_group_info *group)
+{
+    Driver_DMA_set_byte_count(PWM_DMA_LINKED_CHANNEL + group->PWM_active_config.timer_index,
+                              PWM_DMA_LINKED_BYTE_COUNT);
+    Driver_DMA_set_byte_count(group->PWM_active_config.timer_index, PWM_DMA_BYTE_COUNT);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA0_IRQ
+* Description: Run the DMA interrupt of the group of PIT timer 0
+*
+END***************************************************************************/
+static void PWM_DMA0_IRQ(void)
+{
+    PWM_DMA_IRQ(&PWM_groups[0]);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_DMA1_IRQ
+* Description: Run the DMA interrupt of the group of PIT timer 1
+*
+END***************************************************************************/
+static void PWM_DMA1_IRQ(void)
+{
+    PWM_DMA_IRQ(&PWM_groups[1]);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_compute_phases
+* Description: Spread the pulse starts evenly over the period, or keep the
+*              explicit phases, then convert them to PIT counts
+*
+END***************************************************************************/
+static void PWM_compute_phases(PWM_group_info *group)
+{
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if (PWM_PHASE_SPREAD == group->PWM_active_config.phase_mode)
+        {
+            group->phase_steps[channel] = (group->PWM_active_config.resolution * channel) /
+                                          group->PWM_active_config.channel_count;
+        }
+        else if (PWM_PHASE_ALIGNED == group->PWM_active_config.phase_mode)
+        {
+            group->phase_steps[channel] = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        group->phase_counts[channel] = PWM_wrap_edge_time(group,
+                                                          PWM_duty_to_counts(group, group->phase_steps[channel]));
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_start_step
+* Description: An edge aligned pulse starts at the phase, a center aligned
+*              one starts half of its off time later
+*
+END***************************************************************************/
+static uint32_t PWM_start_step(PWM_group_info *group, uint8_t channel, uint32_t duty)
+{
+    uint32_t ret_val = group->phase_steps[channel];    /*This variable stores the return value of the function*/
+
+    if (PWM_ALIGN_CENTER == group->channel_config[channel].alignment)
+    {
+        ret_val += (group->PWM_active_config.resolution - duty) >> 1;
+
+        if (ret_val >= group->PWM_active_config.resolution)
+        {
+            ret_val -= group->PWM_active_config.resolution;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_wrap_edge_time
+* Description: Fold an edge time into the period, near the rails it is
+*              merged with the period start edge
+*
+END***************************************************************************/
+static uint32_t PWM_wrap_edge_time(PWM_group_info *group, uint32_t time)
+{
+    if (time >= group->PWM_active_config.period_counts)
+    {
+        time -= group->PWM_active_config.period_counts;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    if ((time < PWM_MIN_EDGE_COUNTS) || ((group->PWM_active_config.period_counts - time) < PWM_MIN_EDGE_COUNTS))
+    {
+        time = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return time;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_add_channel_to_edge
+* Description: Add the pin of a channel to the masks of an edge
+*
+END***************************************************************************/
+static void PWM_add_channel_to_edge(PWM_group_info *group, PWM_edge_info *edge, uint8_t channel, uint8_t level)
+{
+    uint32_t pin_mask = 1u << group->channel_config[channel].pin;     /*Pin of the channel in its port*/
+    uint8_t port = (uint8_t)group->channel_config[channel].port_type;  /*Port of the channel*/
+
+    /*The pin of a hardware channel is driven by its TPM*/
+    if (0 == (group->hardware_channels & (1u << channel)))
+    {
+        if (1 == level)
+        {
+            edge->on_channels |= 1u << channel;
+        }
+        else
+        {
+            edge->off_channels |= 1u << channel;
+        }
+
+        /*Pin is driven high when the pulse level matches an active high output*/
+        if ((1 == level) && (0 != (group->pair_channels & (1u << channel))))
+        {
+            if (HIGH_STATE == group->channel_config[channel].active_state)
+            {
+                edge->late_set_mask[port] |= pin_mask;
+            }
+            else
+            {
+                edge->late_clear_mask[port] |= pin_mask;
+            }
+        }
+        else if ((1 == level) == (HIGH_STATE == group->channel_config[channel].active_state))
+        {
+            edge->set_mask[port] |= pin_mask;
+        }
+        else
+        {
+            edge->clear_mask[port] |= pin_mask;
+        }
+
+        /*The low side of a pair switches at the same edges with the opposite level*/
+        if (((channel + 1u) < group->PWM_active_config.channel_count) &&
+            (PWM_PAIR_LOW_SIDE == group->channel_config[channel + 1u].pair))
+        {
+            PWM_add_channel_to_edge(group, edge, channel + 1u, (uint8_t)(1u - level));
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_find_edge
+* Description: Find or insert an edge in a sorted edge table
+*
+END***************************************************************************/
+static PWM_edge_info *PWM_find_edge(PWM_edge_info *table, uint8_t *count, uint32_t time)
+{
+    PWM_edge_info *ret_val = NULL;  /*This variable stores the return value of the function*/
+    uint8_t index = 1;              /*The first edge of the table is the period start*/
+    uint8_t shift = 0;              /*Index of the edge to move up*/
+    uint8_t port = 0;               /*Port index*/
+
+    /*Look for an edge close enough to share its interrupt*/
+    while ((index < *count) && (NULL == ret_val))
+    {
+        if (((time >= table[index].time) && ((time - table[index].time) < PWM_MIN_EDGE_COUNTS)) ||
+            ((time < table[index].time) && ((table[index].time - time) < PWM_MIN_EDGE_COUNTS)))
+        {
+            ret_val = &table[index];
+        }
+        else if (table[index].time > time)
+        {
+            break;
+        }
+        else
+        {
+            index++;
+        }
+    }
+
+    /*Insert a new edge and keep the table sorted*/
+    if (NULL == ret_val)
+    {
+        for (shift = *count; shift > index; shift--)
+        {
+            table[shift] = table[shift - 1u];
+        }
+
+        table[index].time = time;
+        table[index].on_channels = 0;
+        table[index].off_channels = 0;
+
+        for (port = 0; port < PWM_PORT_COUNT; port++)
+        {
+            table[index].set_mask[port] = 0;
+            table[index].clear_mask[port] = 0;
+            table[index].late_set_mask[port] = 0;
+            table[index].late_clear_mask[port] = 0;
+        }
+
+        (*count)++;
+        ret_val = &table[index];
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_build_edge_table
+* Description: Build the edge table of one period
+*
+END***************************************************************************/
+static uint8_t PWM_build_edge_table(PWM_group_info *group, PWM_edge_info *table)
+{
+    uint8_t count = 1;          /*Number of edges in the table*/
+    uint8_t kept = 1;           /*Number of edges kept in the table*/
+    uint8_t index = 0;          /*Edge index*/
+    uint8_t channel = 0;        /*Channel index*/
+    uint8_t port = 0;           /*Port index*/
+    uint32_t on_counts = 0;     /*On time of the channel in PIT counts*/
+    uint32_t start = 0;         /*Pulse start of the channel in PIT counts*/
+    uint32_t on_time = 0;       /*Time of the edge where the channel turns on*/
+    uint32_t off_time = 0;      /*Time of the edge where the channel turns off*/
+    PWM_edge_info *edge = NULL; /*Edge where the channel turns off*/
+
+    /*Every period starts with an edge at time 0*/
+    table[0].time = 0;
+    table[0].on_channels = 0;
+    table[0].off_channels = 0;
+
+    for (port = 0; port < PWM_PORT_COUNT; port++)
+    {
+        table[0].set_mask[port] = 0;
+        table[0].clear_mask[port] = 0;
+        table[0].late_set_mask[port] = 0;
+        table[0].late_clear_mask[port] = 0;
+    }
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        on_counts = group->active_on_counts[channel];
+        start = group->phase_counts[channel];
+
+        /*A center aligned pulse starts half of its off time after the phase*/
+        if (PWM_ALIGN_CENTER == group->channel_config[channel].alignment)
+        {
+            start = PWM_wrap_edge_time(group, start + ((group->PWM_active_config.period_counts - on_counts) >> 1));
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        /*The edges of a low side are added with its high side*/
+        if (PWM_PAIR_LOW_SIDE == group->channel_config[channel].pair)
+        {
+            /*Do nothing*/
+        }
+        /*An edge closer to the period start than the ISR can handle is moved to the rail*/
+        else if (on_counts < PWM_MIN_EDGE_COUNTS)
+        {
+            PWM_add_channel_to_edge(group, &table[0], channel, 0);
+        }
+        else if ((group->PWM_active_config.period_counts - on_counts) < PWM_MIN_EDGE_COUNTS)
+        {
+            PWM_add_channel_to_edge(group, &table[0], channel, 1);
+        }
+        else if (0 == start)
+        {
+            PWM_add_channel_to_edge(group, &table[0], channel, 1);
+            edge = PWM_find_edge(table, &count, on_counts);
+            PWM_add_channel_to_edge(group, edge, channel, 0);
+        }
+        /*Phase shifted or center aligned pulse, the period start edge writes the level it has at time 0*/
+        else
+        {
+            on_time = PWM_find_edge(table, &count, start)->time;
+            off_time = PWM_wrap_edge_time(group, start + on_counts);
+
+            if (0 != off_time)
+            {
+                off_time = PWM_find_edge(table, &count, off_time)->time;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            /*Both edges merged with the same interrupt, keep the nearest rail*/
+            if (on_time == off_time)
+            {
+                PWM_add_channel_to_edge(group, &table[0], channel,
+                                        (uint8_t)(on_counts >= (group->PWM_active_config.period_counts / 2u)));
+            }
+            else
+            {
+                /*A pulse ending at the period end is off at time 0*/
+                PWM_add_channel_to_edge(group, &table[0], channel, (uint8_t)((0 != off_time) && (off_time < on_time)));
+                PWM_add_channel_to_edge(group, PWM_find_edge(table, &count, on_time), channel, 1);
+
+                if (0 != off_time)
+                {
+                    PWM_add_channel_to_edge(group, PWM_find_edge(table, &count, off_time), channel, 0);
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+            }
+        }
+    }
+
+    /*An edge left without channel costs an interrupt for nothing*/
+    for (index = 1; index < count; index++)
+    {
+        if (0 != (table[index].on_channels | table[index].off_channels))
+        {
+            table[kept] = table[index];
+            kept++;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return kept;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_build_bam_table
+* Description: Build the slots of one BAM frame, slot k lasts 2^k duty steps
+*              and writes every channel pin from bit k of its duty
+*
+END***************************************************************************/
+static uint8_t PWM_build_bam_table(PWM_group_info *group, PWM_edge_info *table)
+{
+    uint8_t bit = 0;        /*Duty bit of the slot*/
+    uint8_t channel = 0;    /*Channel index*/
+    uint8_t port = 0;       /*Port index*/
+
+    for (bit = 0; bit < group->bam_bits; bit++)
+    {
+        /*Slot k starts after (2^k - 1) duty steps*/
+        table[bit].time = (uint32_t)(((uint64_t)group->PWM_active_config.period_counts * ((1u << bit) - 1u)) /
+                                     group->PWM_active_config.resolution);
+        table[bit].on_channels = 0;
+        table[bit].off_channels = 0;
+
+        for (port = 0; port < PWM_PORT_COUNT; port++)
+        {
+            table[bit].set_mask[port] = 0;
+            table[bit].clear_mask[port] = 0;
+            table[bit].late_set_mask[port] = 0;
+            table[bit].late_clear_mask[port] = 0;
+        }
+
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            /*The slots of a low side are added with its high side*/
+            if (PWM_PAIR_LOW_SIDE != group->channel_config[channel].pair)
+            {
+                PWM_add_channel_to_edge(group, &table[bit], channel,
+                                        (uint8_t)((group->active_duty[channel] >> bit) & 1u));
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+
+    return group->bam_bits;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_spread_table
+* Description: The period change goes to the longest interval, it is limited
+*              so that the interval stays longer than the ISR can handle
+*
+END***************************************************************************/
+static void PWM_spread_table(PWM_group_info *group)
+{
+    PWM_edge_info *table = group->edge_table[group->active_table];    /*Edge table of the scheduled period*/
+    uint8_t index = 0;      /*Edge index*/
+    uint32_t interval = 0;  /*Time from the edge to the next one*/
+    uint32_t longest = 0;   /*Longest interval of the period*/
+
+    for (index = 0; index < group->edge_count[group->active_table]; index++)
+    {
+        if ((index + 1u) < group->edge_count[group->active_table])
+        {
+            interval = table[index + 1u].time - table[index].time;
+        }
+        else
+        {
+            interval = group->PWM_active_config.period_counts - table[index].time;
+        }
+
+        if (interval > longest)
+        {
+            longest = interval;
+            group->spread_index = index;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    group->spread_limit = ((longest - PWM_MIN_EDGE_COUNTS) < group->spread_counts) ?
+                          (longest - PWM_MIN_EDGE_COUNTS) : group->spread_counts;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_spread_period
+* Description: The triangle changes sum to 0 over its cycle. Each change is
+*              the sum of the triangle at the limit of the running table minus
+*              the drift, so the limit is applied at lookup and a table with a
+*              new limit does not leave a drift behind. The random change
+*              takes the sign which brings the drift back when the sum of the
+*              changes goes past PWM_SPREAD_STEPS periods of spread.
+*
+END***************************************************************************/
+static void PWM_spread_period(PWM_group_info *group)
+{
+    uint32_t level = 0;     /*Triangle level, 0 to PWM_SPREAD_STEPS*/
+    int32_t bound = (int32_t)(PWM_SPREAD_STEPS * group->spread_limit);    /*Highest drift of the random spread*/
+    int64_t target = 0;     /*Sum of the triangle changes of the cycle at the running limit*/
+
+    if (PWM_SPREAD_TRIANGLE == group->PWM_active_config.spread_mode)
+    {
+        level = (group->spread_step < PWM_SPREAD_STEPS) ? group->spread_step :
+                ((2u * PWM_SPREAD_STEPS) - group->spread_step);
+        group->spread_sum += (2 * (int32_t)level) - (int32_t)PWM_SPREAD_STEPS;
+        group->spread_step = (uint8_t)((group->spread_step + 1u) & ((2u * PWM_SPREAD_STEPS) - 1u));
+
+        /*The drift left by an older limit is paid back within the running one*/
+        target = ((int64_t)group->spread_sum * (int64_t)group->spread_limit) / (int64_t)PWM_SPREAD_STEPS;
+        group->spread_offset = (int32_t)(target - group->spread_drift);
+
+        if (group->spread_offset > (int32_t)group->spread_limit)
+        {
+            group->spread_offset = (int32_t)group->spread_limit;
+        }
+        else if (group->spread_offset < -(int32_t)group->spread_limit)
+        {
+            group->spread_offset = -(int32_t)group->spread_limit;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        group->spread_drift += group->spread_offset;
+    }
+    else if (PWM_SPREAD_RANDOM == group->PWM_active_config.spread_mode)
+    {
+        group->spread_lfsr = (uint16_t)((group->spread_lfsr >> 1) ^
+                                        ((0u - (group->spread_lfsr & 1u)) & PWM_SPREAD_LFSR_TAPS));
+        group->spread_offset = (int32_t)(((uint64_t)group->spread_lfsr * ((2u * group->spread_limit) + 1u)) >> 16) -
+                               (int32_t)group->spread_limit;
+
+        if ((group->spread_drift + group->spread_offset) > bound)
+        {
+            group->spread_offset = -abs(group->spread_offset);
+        }
+        else if ((group->spread_drift + group->spread_offset) < -bound)
+        {
+            group->spread_offset = abs(group->spread_offset);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        group->spread_drift += group->spread_offset;
+    }
+    else
+    {
+        group->spread_offset = 0;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_next_edge
+* Description: Step the edge schedule by one edge
+*
+END***************************************************************************/
+static PWM_edge_info *PWM_next_edge(PWM_group_info *group, uint32_t *interval)
+{
+    PWM_edge_info *ret_val = NULL;  /*This variable stores the return value of the function*/
+    PWM_edge_info *table = NULL;    /*Edge table of the scheduled period*/
+
+    /*A new period starts, take the new timing and duties if there are some*/
+    if (0 == group->edge_index)
+    {
+        PWM_period_rollover(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    if ((0 == group->edge_index) && (0 != group->table_dirty))
+    {
+        group->table_dirty = 0;
+
+        if (PWM_BAM_MODE == group->PWM_active_config.mode)
+        {
+            group->edge_count[group->active_table ^ 1u] =
+                PWM_build_bam_table(group, group->edge_table[group->active_table ^ 1u]);
+        }
+        else
+        {
+            group->edge_count[group->active_table ^ 1u] =
+                PWM_build_edge_table(group, group->edge_table[group->active_table ^ 1u]);
+        }
+
+        group->active_table ^= 1u;
+        PWM_spread_table(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    if (0 == group->edge_index)
+    {
+        PWM_spread_period(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    table = group->edge_table[group->active_table];
+    ret_val = &table[group->edge_index];
+    group->edge_index++;
+
+    if (group->edge_index < group->edge_count[group->active_table])
+    {
+        *interval = table[group->edge_index].time - ret_val->time;
+    }
+    /*Last edge of the period*/
+    else
+    {
+        *interval = group->PWM_active_config.period_counts - ret_val->time;
+        group->edge_index = 0;
+    }
+
+    /*The period change is added to the longest interval, it leaves the duty table as it is*/
+    if (ret_val == &table[group->spread_index])
+    {
+        *interval = (uint32_t)((int32_t)*interval + group->spread_offset);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_apply_edge
+* Description: Write the port masks of an edge
+*
+END***************************************************************************/
+static void PWM_apply_edge(PWM_group_info *group, PWM_edge_info *edge)
+{
+    uint8_t index = 0;  /*Index in the port list*/
+    uint8_t port = 0;   /*Port index*/
+
+    for (index = 0; index < group->port_count; index++)
+    {
+        port = group->port_list[index];
+
+        if (0 != edge->set_mask[port])
+        {
+            Driver_GPIO_set_port_pins_fast((Port_type_enum_t)port, edge->set_mask[port]);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        if (0 != edge->clear_mask[port])
+        {
+            Driver_GPIO_clear_port_pins_fast((Port_type_enum_t)port, edge->clear_mask[port]);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    /*The pins of a pair turning on wait until the other side is off for the dead time*/
+    if (0 != (edge->on_channels & group->pair_channels))
+    {
+        PWM_wait_dead_time(group);
+
+        for (index = 0; index < group->port_count; index++)
+        {
+            port = group->port_list[index];
+
+            if (0 != edge->late_set_mask[port])
+            {
+                Driver_GPIO_set_port_pins_fast((Port_type_enum_t)port, edge->late_set_mask[port]);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            if (0 != edge->late_clear_mask[port])
+            {
+                Driver_GPIO_clear_port_pins_fast((Port_type_enum_t)port, edge->late_clear_mask[port]);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    group->output_levels = (group->output_levels | edge->on_channels) & ~(edge->off_channels);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_write_pins
+* Description: Write the pin state of some channels from their levels
+*
+END***************************************************************************/
+static void PWM_write_pins(PWM_group_info *group, uint32_t channels, uint32_t levels)
+{
+    uint8_t channel = 0;                        /*Channel index*/
+    Pin_state_enum_t state = LOW_STATE;         /*New pin state of the channel*/
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if (0 != (channels & (1u << channel)))
+        {
+            state = group->channel_config[channel].active_state;
+
+            /*Inactive level is the opposite pin state*/
+            if (0 == (levels & (1u << channel)))
+            {
+                state = (HIGH_STATE == state) ? LOW_STATE : HIGH_STATE;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            Driver_GPIO_set_pin_State_fast(group->channel_config[channel].port_type,
+                                           group->channel_config[channel].pin, state);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_write_levels
+* Description: Write the pins of the channels whose level changed, the pins
+*              of a pair turning on are written after the dead time
+*
+END***************************************************************************/
+static void PWM_write_levels(PWM_group_info *group, uint32_t levels)
+{
+    uint32_t changed = 0;   /*Bit n set if a software channel changed*/
+    uint32_t late = 0;      /*Bit n set if channel n of a pair turns on*/
+
+    changed = (levels ^ group->output_levels) & ~group->hardware_channels;
+    late = changed & levels & group->pair_channels;
+    PWM_write_pins(group, changed & ~late, levels);
+
+    if (0 != late)
+    {
+        PWM_wait_dead_time(group);
+        PWM_write_pins(group, late, levels);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    group->output_levels = levels;
+
+    return;
+}
+
+#ifdef PWM_JITTER_MEASUREMENT
+/*Functions*********************************************************************
+*
+* Function name: PWM_record_jitter
+* Description: Measure how late the output is written after the edge
+*
+END***************************************************************************/
+static void PWM_record_jitter(PWM_group_info *group)
+{
+    uint32_t delay = 0; /*PIT counts elapsed since the interval was reloaded*/
+
+    delay = group->running_load - Driver_PIT_read_current_value_fast(group->PWM_active_config.timer_index);
+
+    if (delay < group->jitter_record.min_counts)
+    {
+        group->jitter_record.min_counts = delay;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    if (delay > group->jitter_record.max_counts)
+    {
+        group->jitter_record.max_counts = delay;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    group->jitter_record.samples++;
+
+    return;
+}
+#endif
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_tick_IRQ
+* Description: Count the duty steps and update the PWM pulse levels
+*
+END***************************************************************************/
+static void PWM_tick_IRQ(void *context)
+{
+    uint8_t channel = 0;            /*Channel index*/
+    uint32_t levels = 0;            /*New level of every channel*/
+    uint32_t changed = 0;           /*Channels whose table marks moved at the rollover*/
+    uint32_t row = 0;               /*First word of the duty step in the pattern buffers*/
+    uint8_t slot = 0;               /*Port index in port_list*/
+    uint32_t queued = 0;            /*Step whose length is written in LDVAL*/
+    int32_t offset = 0;             /*Change of the queued step length made by the moved pulse ends*/
+    PWM_group_info *group = NULL;   /*PWM group of the timer*/
+
+    group = (PWM_group_info *)context;
+
+    /*A moved pulse end is never in the first steps, their lengths are queued before the rollover*/
+    if (0 != group->refine_count)
+    {
+        queued = group->ticks + 2u;
+        if (queued >= group->PWM_active_config.resolution)
+        {
+            queued -= group->PWM_active_config.resolution;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        offset = PWM_step_offset(group, queued);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*Queue the length of the step after the running one, LDVAL keeps a whole step length*/
+    if ((0 != group->tick_fraction) || (0 != offset) || (0 != group->tick_load_offset))
+    {
+        Driver_PIT_update_fractional_load(group->PWM_active_config.timer_index, offset);
+        group->tick_load_offset = offset;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*Increase ticks by 1*/
+    group->ticks++;
+
+    /*If the ticks reach the end of the period*/
+    if (group->ticks >= group->PWM_active_config.resolution)
+    {
+        /*Reset ticks value and take the new timing and duties*/
+        group->ticks = 0;
+        PWM_period_rollover(group);
+
+        if ((1 == group->tick_table) && (0 != group->table_dirty))
+        {
+            changed = PWM_update_pattern(group);
+            group->table_dirty = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*One set and one clear write per port, whatever the number of channels*/
+    if (1 == group->tick_table)
+    {
+#ifdef PWM_JITTER_MEASUREMENT
+        PWM_record_jitter(group);
+#endif
+        row = group->ticks * group->port_count;
+
+        for (slot = 0; slot < group->port_count; slot++)
+        {
+            Driver_GPIO_set_port_pins_fast((Port_type_enum_t)group->port_list[slot],
+                                           group->pattern_set_buffer[row + slot]);
+            Driver_GPIO_clear_port_pins_fast((Port_type_enum_t)group->port_list[slot],
+                                             group->pattern_clear_buffer[row + slot]);
+        }
+
+        /*A moved pulse may have no mark at the first step to bring its pin to the new level*/
+        if (0 != changed)
+        {
+            for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+            {
+                levels |= (uint32_t)PWM_step_level(group, channel, 0) << channel;
+            }
+
+            PWM_write_pins(group, changed, levels);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            /*A low side is on while its high side is off*/
+            if (PWM_PAIR_LOW_SIDE == group->channel_config[channel].pair)
+            {
+                levels |= (~levels << 1) & (1u << channel);
+            }
+            else
+            {
+                levels |= (uint32_t)PWM_step_level(group, channel, group->ticks) << channel;
+            }
+        }
+
+        group->channel_levels = levels;
+
+        /*Only an edge is written to the pins*/
+        if ((PWM_OUTPUT_ISR == group->PWM_active_config.output_stage) && (levels != group->output_levels))
+        {
+#ifdef PWM_JITTER_MEASUREMENT
+            PWM_record_jitter(group);
+#endif
+            PWM_write_levels(group, levels);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    /*The period start is written, nothing moves until a duty leaves the rails*/
+    if ((0 == group->ticks) && (1 == PWM_is_static(group)))
+    {
+        Driver_PIT_select_Timer_state(group->PWM_active_config.timer_index, TIMER_DISABLED);
+        group->PWM_stopped = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_edge_IRQ
+* Description: Output the edge just reached and load the PIT with the
+*              interval after the next edge
+*
+END***************************************************************************/
+static void PWM_edge_IRQ(void *context)
+{
+    uint32_t interval = 0;          /*Length of the interval to load in PIT counts*/
+    uint8_t period_start = 0;       /*The edge starts a period*/
+    PWM_group_info *group = NULL;   /*PWM group of the timer*/
+
+    group = (PWM_group_info *)context;
+    period_start = (uint8_t)(group->pending_edge == &group->edge_table[group->active_table][0]);
+
+    /*The PIT has reloaded the interval scheduled by the previous interrupt*/
+    group->running_load = group->next_load;
+
+    /*Write the edge first so that it is only delayed by the interrupt latency*/
+    if (PWM_OUTPUT_ISR == group->PWM_active_config.output_stage)
+    {
+#ifdef PWM_JITTER_MEASUREMENT
+        PWM_record_jitter(group);
+#endif
+        PWM_apply_edge(group, group->pending_edge);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    group->channel_levels = (group->channel_levels | group->pending_edge->on_channels) &
+                            ~(group->pending_edge->off_channels);
+
+    /*The period start edge wrote every level, nothing moves until a duty leaves the rails*/
+    if ((1 == period_start) && (1 == PWM_is_static(group)))
+    {
+        Driver_PIT_select_Timer_state(group->PWM_active_config.timer_index, TIMER_DISABLED);
+        group->PWM_stopped = 1;
+    }
+    /*The new load value is used when the running interval expires*/
+    else
+    {
+        group->pending_edge = PWM_next_edge(group, &interval);
+        group->next_load = interval - 1u;
+        Driver_PIT_set_load_value_fast(group->PWM_active_config.timer_index, group->next_load);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_is_static
+* Description: The latched duties are on the rails and not fading, the
+*              dither has no sub-step part to add and a low side follows its
+*              high side
+*
+END***************************************************************************/
+static uint8_t PWM_is_static(PWM_group_info *group)
+{
+    uint8_t ret_val = 1;    /*This variable stores the return value of the function*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    /*A duty written since the last rollover is not latched yet*/
+    if (group->shadow_sequence != group->latched_sequence)
+    {
+        ret_val = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+    {
+        if ((0 == (group->hardware_channels & (1u << channel))) &&
+            (PWM_PAIR_LOW_SIDE != group->channel_config[channel].pair) &&
+            (((0 != group->latched_duty[channel]) &&
+              (group->latched_duty[channel] !=
+               (group->PWM_active_config.resolution << group->PWM_active_config.dither_bits))) ||
+             (0 != group->fade_left[channel])))
+        {
+            ret_val = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_start_timer
+* Description: Start the DMA transfers, or output the first edge, or the
+*              first tick, and start the PIT timer
+*
+END***************************************************************************/
+static void PWM_start_timer(PWM_group_info *group)
+{
+    uint32_t interval = 0;      /*Length of the first interval in PIT counts*/
+    PWM_edge_info *edge = NULL; /*First edge of the schedule*/
+
+    /*PIT configuration info*/
+    PIT_config_info PIT_config = {
+        .MCR_config.freeze_mode = TIMERS_STOPPED_IN_DEBUG,
+        .MCR_config.module_state = PIT_ENABLED,
+        .TCTRLn_config.timer_state = TIMER_ENABLED,
+        .TCTRLn_config.chain_mode = CHAIN_MODE_DISABLED,
+        .TCTRLn_config.IRQ_state = IRQ_ENABLED,
+    };
+
+    PIT_config.TCTRLn_config.timer_index = group->PWM_active_config.timer_index;
+
+    /*Every channel runs on a TPM, the PIT is not needed*/
+    if (0 == group->port_count)
+    {
+        /*Do nothing*/
+    }
+    else if (PWM_DMA_MODE == group->PWM_active_config.mode)
+    {
+        PWM_DMA_start(group, &PIT_config);
+    }
+    else if (PWM_TICK_MODE != group->PWM_active_config.mode)
+    {
+        /*Output the first edge and start the timer with the interval after it*/
+        group->table_dirty = 1;
+        group->edge_index = 0;
+        edge = PWM_next_edge(group, &interval);
+        PWM_apply_edge(group, edge);
+        group->channel_levels = group->output_levels;
+        group->running_load = interval - 1u;
+        PIT_config.load_value = group->running_load;
+        PIT_config.TCTRLn_config.chain_mode = (PWM_TIMEBASE_CHAINED == group->PWM_active_config.timebase) ?
+                                              CHAIN_MODE_ENABLED : CHAIN_MODE_DISABLED;
+        Driver_PIT_register_callabck(group->PWM_active_config.timer_index, PWM_edge_IRQ, group);
+        Driver_PIT_init(&PIT_config);
+
+        /*Queue the second interval behind the running one*/
+        group->pending_edge = PWM_next_edge(group, &interval);
+        group->next_load = interval - 1u;
+        Driver_PIT_set_load_value(group->PWM_active_config.timer_index, group->next_load);
+
+        /*The chained timer counts once PIT0 runs its prescaler, PIT0 does not interrupt*/
+        if (PWM_TIMEBASE_CHAINED == group->PWM_active_config.timebase)
+        {
+            PIT_config.TCTRLn_config.timer_index = 0;
+            PIT_config.TCTRLn_config.chain_mode = CHAIN_MODE_DISABLED;
+            PIT_config.TCTRLn_config.IRQ_state = IRQ_DISABLED;
+            PIT_config.load_value = group->PWM_active_config.chain_prescaler - 1u;
+            Driver_PIT_init(&PIT_config);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*One interrupt per duty step, the first one starts a period and takes the duties*/
+        group->ticks = group->PWM_active_config.resolution - 1u;
+        group->tick_table = (uint8_t)((PWM_TICK_TABLE == group->PWM_active_config.tick_output) &&
+                                      (PWM_OUTPUT_ISR == group->PWM_active_config.output_stage));
+
+        /*The marks of the duties the pins are holding*/
+        if (1 == group->tick_table)
+        {
+            PWM_clear_pattern(group);
+            (void)PWM_update_pattern(group);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        group->running_load = (group->PWM_active_config.period_counts / group->PWM_active_config.resolution) - 1u;
+        PIT_config.load_value = group->running_load;
+        Driver_PIT_register_callabck(group->PWM_active_config.timer_index, PWM_tick_IRQ, group);
+        Driver_PIT_init(&PIT_config);
+        PWM_set_tick_load(group, group->PWM_active_config.period_counts, group->PWM_active_config.resolution);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_resume
+* Description: The interrupt stopped the PIT on a static output, it cannot
+*              run until the timer is started again from a period start
+*
+END***************************************************************************/
+static void PWM_resume(PWM_group_info *group)
+{
+    if (1 == group->PWM_stopped)
+    {
+        group->PWM_stopped = 0;
+        PWM_start_timer(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PWM_stop_group
+* Description: The interrupt is removed before anything else, so it can not
+*              see the tables being rewritten. The TPM and DMA backends are
+*              stopped and the TPM pins are given back to GPIO.
+*
+END***************************************************************************/
+static void PWM_stop_group(PWM_group_info *group)
+{
+    uint8_t channel = 0;                                            /*Channel index*/
+    uint8_t TPM_index = 0;                                          /*TPM module index*/
+    uint8_t timer_index = group->PWM_active_config.timer_index;     /*PIT timer of the group*/
+
+    /*A group never initialized has no channel*/
+    if (0 != group->PWM_active_config.channel_count)
+    {
+        Driver_PIT_release_timer(timer_index);
+
+        /*PIT0 runs the prescaler of a chained period*/
+        if (PWM_TIMEBASE_CHAINED == group->PWM_active_config.timebase)
+        {
+            Driver_PIT_release_timer(0);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        if ((PWM_DMA_MODE == group->PWM_active_config.mode) && (0 != group->port_count))
+        {
+            Driver_DMAMUX_disable(timer_index);
+            Driver_DMA_stop(timer_index);
+            Driver_DMA_stop(PWM_DMA_LINKED_CHANNEL + timer_index);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+        {
+            if (0 != (group->hardware_channels & (1u << channel)))
+            {
+                Driver_TPM_config_channel(group->hardware_route[channel].TPM_index,
+                                          group->hardware_route[channel].channel, TPM_CHANNEL_DISABLED);
+                Driver_PORT_set_MUX_pin(group->channel_config[channel].port_type, group->channel_config[channel].pin,
+                                        MUX_GPIO);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        /*The TPM modules of the group count no other period*/
+        for (TPM_index = 0; TPM_index < TPM_MODULE_COUNT; TPM_index++)
+        {
+            if (0 != (group->TPM_used & (1u << TPM_index)))
+            {
+                Driver_TPM_stop(TPM_index);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        group->hardware_channels = 0;
+        group->TPM_used = 0;
+        group->PWM_stopped = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_init
+* Description: Init the software PWM and start its PIT timer
+*
+END***************************************************************************/
+void Driver_PWM_init(PWM_config_info *PWM_config)
+{
+    uint8_t channel = 0;            /*Channel index*/
+    uint8_t port = 0;               /*Port index*/
+    uint8_t ports_used = 0;         /*Bit n set if port n contains a channel*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check input*/
+    if ((NULL != PWM_config) && (PWM_config->timer_index < PWM_GROUP_COUNT) && (NULL != PWM_config->channels) &&
+        (0 != PWM_config->channel_count) && (PWM_config->channel_count <= PWM_MAX_CHANNELS) &&
+        (PWM_STATUS_OK == PWM_check_timing(PWM_config->mode, PWM_config->period_counts,
+                                           PWM_config->resolution, PWM_config->dither_bits)) &&
+        (1 == PWM_check_ports(PWM_config)) && (PWM_config->spread_mode <= PWM_SPREAD_RANDOM) &&
+        (PWM_config->spread_permille <= PWM_MAX_SPREAD_PERMILLE) && (1 == PWM_check_pairs(PWM_config)) &&
+        (1 == PWM_check_tick_resolution(PWM_config)) &&
+        (PWM_dead_time_to_counts(PWM_config) <= PWM_MAX_DEAD_COUNTS) && (1 == PWM_check_timebase(PWM_config)))
+    {
+        group = &PWM_groups[PWM_config->timer_index];
+        PWM_stop_group(group);
+        group->PWM_active_config = *PWM_config;
+        group->PWM_active_config.channels = group->channel_config;
+        group->bam_bits = PWM_count_bam_bits(PWM_config->resolution);
+        group->counts_per_step = (uint32_t)(((uint64_t)PWM_config->period_counts << 16) / PWM_config->resolution);
+        group->spread_counts = (uint32_t)(((uint64_t)PWM_config->period_counts * PWM_config->spread_permille) / 1000u);
+        group->spread_index = 0;
+        group->spread_limit = 0;
+        group->spread_offset = 0;
+        group->spread_drift = 0;
+        group->spread_step = 0;
+        group->spread_sum = 0;
+        group->spread_lfsr = 1u;
+        group->dead_counts = PWM_dead_time_to_counts(PWM_config);
+        group->pair_channels = 0;
+        group->tick_table = 0;
+        group->PWM_stopped = 0;
+        group->timing_pending = 0;
+        group->shadow_sequence = 0;
+        group->latched_sequence = 0;
+        group->update_open = 0;
+        group->pattern_set_buffer = pattern_set_buffers[PWM_config->timer_index];
+        group->pattern_clear_buffer = pattern_clear_buffers[PWM_config->timer_index];
+#ifdef PWM_JITTER_MEASUREMENT
+        group->jitter_record.min_counts = 0xFFFFFFFFu;
+        group->jitter_record.max_counts = 0;
+        group->jitter_record.samples = 0;
+#endif
+
+        /*Keep the channels and the list of ports they use*/
+        for (channel = 0; channel < PWM_config->channel_count; channel++)
+        {
+            group->channel_config[channel] = PWM_config->channels[channel];
+            group->shadow_duty[channel] = 0;
+            group->shadow_fade_periods[channel] = 0;
+            group->shadow_fade_step[channel] = 0;
+            group->shadow_fade_curve[channel] = PWM_FADE_LINEAR;
+            group->fade_target[channel] = 0;
+            group->fade_periods[channel] = 0;
+            group->fade_curve[channel] = PWM_FADE_LINEAR;
+            group->fade_left[channel] = 0;
+            group->latched_duty[channel] = 0;
+            group->active_duty[channel] = 0;
+            group->active_on_counts[channel] = 0;
+            group->dither_error[channel] = 0;
+            group->phase_steps[channel] = group->channel_config[channel].phase % PWM_config->resolution;
+
+            if (PWM_PAIR_LOW_SIDE == group->channel_config[channel].pair)
+            {
+                group->pair_channels |= 3u << (channel - 1u);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        PWM_compute_phases(group);
+        PWM_setup_hardware(group);
+
+        /*The PIT engine only writes the ports of the software channels*/
+        for (channel = 0; channel < PWM_config->channel_count; channel++)
+        {
+            if (0 == (group->hardware_channels & (1u << channel)))
+            {
+                ports_used |= 1u << (uint8_t)group->channel_config[channel].port_type;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        group->port_count = 0;
+
+        for (port = 0; port < PWM_PORT_COUNT; port++)
+        {
+            if (0 != (ports_used & (1u << port)))
+            {
+                group->port_list[group->port_count] = port;
+                group->port_slot[port] = group->port_count;
+                group->port_count++;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        /*Every pin starts on low logic level*/
+        group->output_levels = 0xFFFFFFFFu;
+        PWM_write_levels(group, 0);
+        group->channel_levels = 0;
+
+        PWM_start_timer(group);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_config_frequency
+* Description: Fill the period of a PWM configuration from the bus clock
+*
+END***************************************************************************/
+PWM_status_enum_t Driver_PWM_config_frequency(PWM_config_info *PWM_config, uint32_t frequency,
+                                              uint32_t resolution, uint32_t *achieved_frequency)
+{
+    PWM_status_enum_t ret_val = PWM_STATUS_INVALID; /*This variable stores the return value of the function*/
+    uint32_t period_counts = 0;                     /*PWM period in PIT counts*/
+
+    /*Check input*/
+    if (NULL != PWM_config)
+    {
+        period_counts = PWM_frequency_to_counts(frequency, achieved_frequency);
+        ret_val = PWM_check_timing(PWM_config->mode, period_counts, resolution, PWM_config->dither_bits);
+
+        if (PWM_STATUS_OK == ret_val)
+        {
+            PWM_config->period_counts = period_counts;
+            PWM_config->resolution = resolution;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_config_long_period
+* Description: Fill a chained timebase and the period of a PWM configuration
+*
+END***************************************************************************/
+PWM_status_enum_t Driver_PWM_config_long_period(PWM_config_info *PWM_config, uint32_t period_ms, uint32_t resolution)
+{
+    PWM_status_enum_t ret_val = PWM_STATUS_INVALID; /*This variable stores the return value of the function*/
+    uint64_t period_clocks = 0;                     /*PWM period in bus clock cycles*/
+    uint64_t step_limit = 0;                        /*Longest period the prescaler must bring into range*/
+    uint64_t prescaler = 0;                         /*Bus clock cycles per PIT count*/
+    uint32_t period_counts = 0;                     /*PWM period in PIT counts*/
+
+    /*Check input*/
+    if ((NULL != PWM_config) && (0 != resolution))
+    {
+        period_clocks = ((uint64_t)period_ms * Driver_SIM_get_bus_clock()) / 1000u;
+        step_limit = (uint64_t)resolution * PWM_MAX_STEP_COUNTS;
+        prescaler = (period_clocks + step_limit - 1u) / step_limit;
+
+        if ((0 != prescaler) && (prescaler <= 0xFFFFFFFFu))
+        {
+            period_counts = (uint32_t)((period_clocks + (prescaler / 2u)) / prescaler);
+            ret_val = PWM_check_timing(PWM_config->mode, period_counts, resolution, PWM_config->dither_bits);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        if (PWM_STATUS_OK == ret_val)
+        {
+            PWM_config->timebase = PWM_TIMEBASE_CHAINED;
+            PWM_config->chain_prescaler = (uint32_t)prescaler;
+            PWM_config->period_counts = period_counts;
+            PWM_config->resolution = resolution;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_set_frequency
+* Description: Retune the running PWM from the next period
+*
+END***************************************************************************/
+PWM_status_enum_t Driver_PWM_set_frequency(uint8_t timer_index, uint32_t frequency, uint32_t resolution,
+                                           uint32_t *achieved_frequency)
+{
+    PWM_status_enum_t ret_val = PWM_STATUS_INVALID; /*This variable stores the return value of the function*/
+    uint32_t period_counts = 0;                     /*PWM period in PIT counts*/
+    uint8_t prescaler = 0;                          /*TPM prescaler of the new period*/
+    uint16_t modulo = 0;                            /*TPM modulo of the new period*/
+    uint8_t channel = 0;                            /*Channel index*/
+    uint8_t TPM_index = 0;                          /*TPM module index*/
+    TPM_config_info TPM_config;                     /*TPM module configuration*/
+    PWM_group_info *group = NULL;                   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        /*The PWM must be running, a chained period only changes with a new init*/
+        if ((0 != group->PWM_active_config.channel_count) &&
+            (PWM_TIMEBASE_BUS == group->PWM_active_config.timebase))
+        {
+            period_counts = PWM_frequency_to_counts(frequency, achieved_frequency);
+            ret_val = PWM_check_timing(group->PWM_active_config.mode, period_counts, resolution,
+                                       group->PWM_active_config.dither_bits);
+
+            /*The hardware channels keep the same period, the DMA pattern the same length, the tick table must fit*/
+            if ((PWM_STATUS_OK == ret_val) && (0 != group->hardware_channels) &&
+                (0 == PWM_TPM_timing(period_counts, &prescaler, &modulo)))
+            {
+                ret_val = PWM_STATUS_INVALID;
+            }
+            else if ((PWM_STATUS_OK == ret_val) && (PWM_DMA_MODE == group->PWM_active_config.mode) &&
+                     (resolution != group->PWM_active_config.resolution))
+            {
+                ret_val = PWM_STATUS_INVALID;
+            }
+            else if ((PWM_STATUS_OK == ret_val) && (1 == group->tick_table) &&
+                     ((resolution * group->port_count) > PWM_TICK_TABLE_MAX_ENTRIES))
+            {
+                ret_val = PWM_STATUS_INVALID;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            if ((PWM_STATUS_OK == ret_val) && (0 != group->hardware_channels))
+            {
+                group->TPM_prescaler = prescaler;
+                group->TPM_modulo = modulo;
+
+                for (TPM_index = 0; TPM_index < TPM_MODULE_COUNT; TPM_index++)
+                {
+                    if (0 != (group->TPM_used & (1u << TPM_index)))
+                    {
+                        TPM_config.TPM_index = TPM_index;
+                        TPM_config.prescaler = prescaler;
+                        TPM_config.modulo = modulo;
+                        Driver_TPM_init(&TPM_config);
+                    }
+                    else
+                    {
+                        /*Do nothing*/
+                    }
+                }
+
+                for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+                {
+                    if (0 != (group->hardware_channels & (1u << channel)))
+                    {
+                        group->hardware_duty[channel] =
+                            (uint32_t)(((uint64_t)group->hardware_duty[channel] * resolution) /
+                                       group->hardware_resolution);
+                    }
+                    else
+                    {
+                        /*Do nothing*/
+                    }
+                }
+
+                group->hardware_resolution = resolution;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            /*Without PIT interrupt, the timing is applied now*/
+            if ((PWM_STATUS_OK == ret_val) &&
+                ((0 == group->port_count) || (PWM_DMA_MODE == group->PWM_active_config.mode) ||
+                 (1 == group->PWM_stopped)))
+            {
+                group->pending_period_counts = period_counts;
+                group->pending_resolution = resolution;
+                PWM_apply_timing(group);
+            }
+            else if (PWM_STATUS_OK == ret_val)
+            {
+                /*The PIT interrupt takes the new timing at the next period rollover*/
+                group->timing_pending = 0;
+                group->pending_period_counts = period_counts;
+                group->pending_resolution = resolution;
+                group->timing_pending = 1;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            /*The match values follow the new modulo and resolution*/
+            for (channel = 0; (PWM_STATUS_OK == ret_val) &&
+                 (channel < group->PWM_active_config.channel_count); channel++)
+            {
+                if (0 != (group->hardware_channels & (1u << channel)))
+                {
+                    PWM_write_hardware_duty(group, channel);
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_set_duty
+* Description: Publish a new duty of a channel for the next PWM period
+*
+END***************************************************************************/
+void Driver_PWM_set_duty(uint8_t timer_index, uint8_t channel, uint32_t duty)
+{
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        /*Check channel index, the duty of a low side follows its high side*/
+        if ((channel < group->PWM_active_config.channel_count) &&
+            (PWM_PAIR_LOW_SIDE != group->channel_config[channel].pair))
+        {
+            /*Limit duty to 100%*/
+            if (duty > (group->PWM_active_config.resolution << group->PWM_active_config.dither_bits))
+            {
+                duty = group->PWM_active_config.resolution << group->PWM_active_config.dither_bits;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            /*The TPM latches its match value at the counter overflow*/
+            if (0 != (group->hardware_channels & (1u << channel)))
+            {
+                group->hardware_duty[channel] = duty;
+
+                if (0 == group->update_open)
+                {
+                    PWM_write_hardware_duty(group, channel);
+                }
+                else
+                {
+                    group->hardware_pending |= 1u << channel;
+                }
+            }
+            /*The DMA pattern is rewritten by the foreground*/
+            else if (PWM_DMA_MODE == group->PWM_active_config.mode)
+            {
+                group->shadow_duty[channel] = duty;
+
+                if (0 == group->update_open)
+                {
+                    PWM_DMA_write_duty(group, channel);
+                }
+                else
+                {
+                    group->DMA_pending |= 1u << channel;
+                }
+            }
+            /*Only a real change is published to the PIT interrupt, a fade is stopped*/
+            else if ((duty != group->shadow_duty[channel]) || (0 != group->shadow_fade_periods[channel]))
+            {
+                /*Outside a batch, this write is an update of its own*/
+                if (0 == group->update_open)
+                {
+                    group->shadow_sequence++;
+                    group->shadow_duty[channel] = duty;
+                    group->shadow_fade_periods[channel] = 0;
+                    group->shadow_sequence++;
+                    PWM_resume(group);
+                }
+                else
+                {
+                    group->shadow_duty[channel] = duty;
+                    group->shadow_fade_periods[channel] = 0;
+                }
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_fade
+* Description: Publish a fade request, the PIT interrupt runs it
+*
+END***************************************************************************/
+void Driver_PWM_fade(uint8_t timer_index, uint8_t channel, uint32_t duty, uint32_t duration_ms,
+                     PWM_fade_curve_enum_t curve)
+{
+    uint32_t periods = 0;           /*Length of the fade in PWM periods*/
+    uint32_t step = 0;              /*Progress per period, 32 fractional bits*/
+    uint32_t count_clocks = 1;      /*Bus clock cycles per PIT count*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        /*Check input, the duty of a low side follows its high side*/
+        if ((channel < group->PWM_active_config.channel_count) &&
+            (PWM_PAIR_LOW_SIDE != group->channel_config[channel].pair) &&
+            (curve <= PWM_FADE_S_CURVE))
+        {
+            /*Limit duty to 100%*/
+            if (duty > (group->PWM_active_config.resolution << group->PWM_active_config.dither_bits))
+            {
+                duty = group->PWM_active_config.resolution << group->PWM_active_config.dither_bits;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            if (PWM_TIMEBASE_CHAINED == group->PWM_active_config.timebase)
+            {
+                count_clocks = group->PWM_active_config.chain_prescaler;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            /*The only division of the fade is done here*/
+            periods = (uint32_t)(((uint64_t)duration_ms * Driver_SIM_get_bus_clock()) /
+                                 ((uint64_t)group->PWM_active_config.period_counts * 1000u * count_clocks));
+            step = (0 != periods) ? (0xFFFFFFFFu / periods) : 0;
+
+            /*Without a PIT period interrupt, the duty is set at once*/
+            if ((0 != (group->hardware_channels & (1u << channel))) || (PWM_DMA_MODE == group->PWM_active_config.mode))
+            {
+                Driver_PWM_set_duty(timer_index, channel, duty);
+            }
+            /*The same request written again keeps the running fade*/
+            else if ((duty != group->shadow_duty[channel]) || (periods != group->shadow_fade_periods[channel]) ||
+                     ((uint8_t)curve != group->shadow_fade_curve[channel]))
+            {
+                /*Outside a batch, this write is an update of its own*/
+                if (0 == group->update_open)
+                {
+                    group->shadow_sequence++;
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+
+                group->shadow_duty[channel] = duty;
+                group->shadow_fade_periods[channel] = periods;
+                group->shadow_fade_step[channel] = step;
+                group->shadow_fade_curve[channel] = (uint8_t)curve;
+
+                if (0 == group->update_open)
+                {
+                    group->shadow_sequence++;
+                    PWM_resume(group);
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_is_fading
+* Description: The output duty has not reached the last duty written
+*
+END***************************************************************************/
+uint8_t Driver_PWM_is_fading(uint8_t timer_index, uint8_t channel)
+{
+    uint8_t ret_val = 0;            /*This variable stores the return value of the function*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        /*A hardware channel or a DMA mode channel has its duty at once*/
+        if ((channel < group->PWM_active_config.channel_count) && (0 == (group->hardware_channels & (1u << channel))) &&
+            (PWM_DMA_MODE != group->PWM_active_config.mode))
+        {
+            ret_val = (uint8_t)(group->latched_duty[channel] != group->shadow_duty[channel]);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_begin_update
+* Description: Open a batch of duty updates. The sequence is odd until
+*              Driver_PWM_end_update, the PIT interrupt keeps the duties it has.
+*
+END***************************************************************************/
+void Driver_PWM_begin_update(uint8_t timer_index)
+{
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        if (0 == group->update_open)
+        {
+            group->update_open = 1;
+            group->shadow_sequence++;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_end_update
+* Description: Close a batch of duty updates, they are latched together at the
+*              next period rollover.
+*
+END***************************************************************************/
+void Driver_PWM_end_update(uint8_t timer_index)
+{
+    uint8_t channel = 0;            /*Channel index*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        if (0 != group->update_open)
+        {
+            group->shadow_sequence++;
+            group->update_open = 0;
+
+            for (channel = 0; channel < group->PWM_active_config.channel_count; channel++)
+            {
+                if (0 != (group->hardware_pending & (1u << channel)))
+                {
+                    PWM_write_hardware_duty(group, channel);
+                }
+                else if (0 != (group->DMA_pending & (1u << channel)))
+                {
+                    PWM_DMA_write_duty(group, channel);
+                }
+                else
+                {
+                    /*Do nothing*/
+                }
+            }
+
+            group->hardware_pending = 0;
+            group->DMA_pending = 0;
+            PWM_resume(group);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_read_level
+* Description: Read the current level of the PWM pulse of a channel
+*
+END***************************************************************************/
+uint8_t Driver_PWM_read_level(uint8_t timer_index, uint8_t channel)
+{
+    uint8_t ret_val = 0;            /*This variable stores the return value of the function*/
+    uint32_t on_counts = 0;         /*On time of the hardware channel in TPM counts*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        if ((channel < group->PWM_active_config.channel_count) && (0 != (group->hardware_channels & (1u << channel))))
+        {
+            on_counts = (uint32_t)(((uint64_t)group->hardware_duty[channel] * ((uint32_t)group->TPM_modulo + 1u)) /
+                                   ((uint64_t)group->hardware_resolution << group->PWM_active_config.dither_bits));
+            ret_val = (uint8_t)(Driver_TPM_read_counter(group->hardware_route[channel].TPM_index) < on_counts);
+        }
+        else if ((channel < group->PWM_active_config.channel_count) && (PWM_DMA_MODE == group->PWM_active_config.mode))
+        {
+            ret_val = PWM_step_level(group, channel, PWM_DMA_current_step(group));
+        }
+        else if ((channel < group->PWM_active_config.channel_count) && (1 == group->tick_table))
+        {
+            ret_val = PWM_step_level(group, channel, group->ticks);
+        }
+        else
+        {
+            ret_val = (uint8_t)((group->channel_levels >> channel) & 1u);
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_update_output
+* Description: Write the PWM levels to the pins from the main loop
+*
+END***************************************************************************/
+void Driver_PWM_update_output(uint8_t timer_index)
+{
+    uint32_t levels = 0;            /*Levels computed by the PIT interrupt*/
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+        levels = group->channel_levels;
+
+        /*Only an edge is written to the pins*/
+        if ((PWM_OUTPUT_FOREGROUND == group->PWM_active_config.output_stage) && (levels != group->output_levels))
+        {
+#ifdef PWM_JITTER_MEASUREMENT
+            PWM_record_jitter(group);
+#endif
+            PWM_write_levels(group, levels);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+#ifdef PWM_JITTER_MEASUREMENT
+/*Functions*********************************************************************
+*
+* Function name: Driver_PWM_read_jitter
+* Description: Read and restart the edge to pin write delay measurement
+*
+END***************************************************************************/
+void Driver_PWM_read_jitter(uint8_t timer_index, PWM_jitter_info *jitter)
+{
+    PWM_group_info *group = NULL;   /*State of the PWM group of the timer*/
+
+    /*Check timer index*/
+    if (timer_index < PWM_GROUP_COUNT)
+    {
+        group = &PWM_groups[timer_index];
+
+        if (NULL != jitter)
+        {
+            *jitter = group->jitter_record;
+            group->jitter_record.min_counts = 0xFFFFFFFFu;
+            group->jitter_record.max_counts = 0;
+            group->jitter_record.samples = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+#endif
+/*EOF*/
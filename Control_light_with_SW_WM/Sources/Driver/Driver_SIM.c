@@ -62,4 +62,123 @@ void Driver_SIM_SCGC6_init_clock(SCGC6_config_info *SCGC6_clock_config)
 
     return;
 }
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_get_bus_clock
+* Description: Get the bus clock frequency from the current clock settings.
+*
+END***************************************************************************/
+uint32_t Driver_SIM_get_bus_clock(void)
+{
+    /*Refresh SystemCoreClock from the MCG and SIM registers*/
+    SystemCoreClockUpdate();
+
+    return SystemCoreClock / ((uint32_t)HAL_SIM_CLKDIV1_read_OUTDIV4() + 1u);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_set_TPM_clock
+* Description: Set the clock gate of a TPM module.
+*
+END***************************************************************************/
+void Driver_SIM_set_TPM_clock(uint8_t TPM_index, clock_gate_state_enum_t gate_state)
+{
+    /*Check TPM index*/
+    switch (TPM_index)
+    {
+    case 0:
+    {
+        HAL_SIM_SCGC6_set_clock_TPM0((uint8_t)gate_state);
+        break;
+    }
+    case 1:
+    {
+        HAL_SIM_SCGC6_set_clock_TPM1((uint8_t)gate_state);
+        break;
+    }
+    case 2:
+    {
+        HAL_SIM_SCGC6_set_clock_TPM2((uint8_t)gate_state);
+        break;
+    }
+    default:
+        break;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_set_DMA_clock
+* Description: Set the clock gates of the DMA controller and of the DMAMUX.
+*
+END***************************************************************************/
+void Driver_SIM_set_DMA_clock(clock_gate_state_enum_t gate_state)
+{
+    /*Check input*/
+    if ((DISABLED <= gate_state) && (gate_state <= ENABLED))
+    {
+        HAL_SIM_SCGC6_set_clock_DMAMUX((uint8_t)gate_state);
+        HAL_SIM_SCGC7_set_clock_DMA((uint8_t)gate_state);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_select_TPM_clock_source
+* Description: Select the clock source of the TPM modules.
+*
+END***************************************************************************/
+void Driver_SIM_select_TPM_clock_source(TPM_clock_source_enum_t clock_source)
+{
+    /*Check input*/
+    if ((TPM_CLOCK_DISABLED <= clock_source) && (clock_source <= TPM_CLOCK_MCGIRCLK))
+    {
+        HAL_SIM_SOPT2_set_TPMSRC((uint8_t)clock_source);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_get_TPM_clock
+* Description: Get the MCGFLLCLK or MCGPLLCLK/2 frequency from the core clock.
+*
+END***************************************************************************/
+uint32_t Driver_SIM_get_TPM_clock(void)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    /*Refresh SystemCoreClock from the MCG and SIM registers*/
+    SystemCoreClockUpdate();
+
+    /*MCGOUTCLK is the FLL or PLL output, the core clock divides it by (OUTDIV1 + 1)*/
+    ret_val = SystemCoreClock * ((uint32_t)HAL_SIM_CLKDIV1_read_OUTDIV1() + 1u);
+
+    /*The PLL clock is divided by 2 for the peripherals*/
+    if (1 == HAL_SIM_SOPT2_read_PLLFLLSEL())
+    {
+        ret_val /= 2u;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
 /*EOF*/
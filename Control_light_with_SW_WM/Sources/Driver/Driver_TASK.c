@@ -0,0 +1,304 @@
+/**
+ * @file  : Driver_TASK.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_TASK.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_CORE.h"
+#include "../Includes/Driver/Driver_TASK.h"
+#include "../Includes/Driver/Driver_TIMER.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TASK_DEBRUIJN (0x077CB531u)     /*De Bruijn sequence of the trailing zero count*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief State of one task
+ */
+typedef struct TASK
+{
+    task_function task_func;    /*Function of the task, NULL while the task is not created*/
+    void *context;              /*Pointer passed to the function*/
+    uint32_t min_interval;      /*Shortest time between the starts of two runs in timer ticks*/
+    uint32_t events;            /*Event bits posted since the last run*/
+    uint32_t periodic_events;   /*Event bits posted by the periodic timer*/
+    uint32_t bit;               /*Bit of the task in the bitmaps*/
+    TIMER_info hold_timer;      /*Timer of the rate limit, it releases the task*/
+    TIMER_info periodic_timer;  /*Timer of the periodic events*/
+} TASK_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static TASK_info TASK_tasks[TASK_MAX_TASKS];    /*State of each task, indexed by priority*/
+
+static volatile uint32_t TASK_ready = 0;    /*Bit n is set while task n has events and is not held*/
+static volatile uint32_t TASK_held = 0;     /*Bit n is set while the rate limit of task n holds it back*/
+
+/*Bit index of a single set bit, indexed by the top 5 bits of the bit times the De Bruijn sequence*/
+static const uint8_t TASK_debruijn_table[32] = {
+    0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+    31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u,
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Release a task at the end of its rate limit, called from the PIT interrupt
+ *
+ * @param context is the task
+ *
+ * @return: this function return nothing.
+ */
+static void TASK_release_IRQ(void *context);
+
+/**
+ * @brief Post the periodic events of a task, called from the PIT interrupt
+ *
+ * @param context is the task
+ *
+ * @return: this function return nothing.
+ */
+static void TASK_periodic_IRQ(void *context);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: TASK_release_IRQ
+* Description: The events posted while the task was held make it ready
+*
+END***************************************************************************/
+static void TASK_release_IRQ(void *context)
+{
+    TASK_info *task = (TASK_info *)context; /*Task released*/
+    uint32_t primask = 0;                   /*Interrupt mask of the caller*/
+
+    /*A higher priority interrupt may post to the task*/
+    primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+    TASK_held &= ~(task->bit);
+    if (0 != task->events)
+    {
+        TASK_ready |= task->bit;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    HAL_CORE_PRIMASK_restore(primask);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: TASK_periodic_IRQ
+* Description: Post the periodic events of the task
+*
+END***************************************************************************/
+static void TASK_periodic_IRQ(void *context)
+{
+    TASK_info *task = (TASK_info *)context; /*Task of the periodic timer*/
+
+    Driver_TASK_post((uint8_t)(task - TASK_tasks), task->periodic_events);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TASK_create
+* Description: The timers of the task are stopped before its entry is
+*              written, so no callback sees a half written task
+*
+END***************************************************************************/
+void Driver_TASK_create(TASK_config_info *TASK_config)
+{
+    TASK_info *task = NULL; /*Entry of the task*/
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+
+    /*Check input*/
+    if ((NULL != TASK_config) && (TASK_config->priority < TASK_MAX_TASKS) && (NULL != TASK_config->task_func) &&
+        (TASK_config->min_interval_ticks <= TIMER_MAX_DELAY_TICKS))
+    {
+        task = &TASK_tasks[TASK_config->priority];
+        Driver_TIMER_stop(&task->hold_timer);
+        Driver_TIMER_stop(&task->periodic_timer);
+
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+        task->bit = 1u << TASK_config->priority;
+        task->context = TASK_config->context;
+        task->min_interval = TASK_config->min_interval_ticks;
+        task->events = 0;
+        task->periodic_events = 0;
+        task->task_func = TASK_config->task_func;
+        TASK_ready &= ~(task->bit);
+        TASK_held &= ~(task->bit);
+
+        HAL_CORE_PRIMASK_restore(primask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TASK_post
+* Description: OR the events in the task and mark it ready
+*
+END***************************************************************************/
+void Driver_TASK_post(uint8_t priority, uint32_t events)
+{
+    TASK_info *task = NULL; /*Task posted to*/
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+
+    /*Check input*/
+    if ((priority < TASK_MAX_TASKS) && (NULL != TASK_tasks[priority].task_func) && (0 != events))
+    {
+        task = &TASK_tasks[priority];
+
+        /*An interrupt may post between the read and the write*/
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+        task->events |= events;
+        if (0 == (TASK_held & task->bit))
+        {
+            TASK_ready |= task->bit;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        HAL_CORE_PRIMASK_restore(primask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TASK_start_periodic
+* Description: Start or stop the periodic timer of the task
+*
+END***************************************************************************/
+void Driver_TASK_start_periodic(uint8_t priority, uint32_t events, uint32_t period_ticks)
+{
+    TASK_info *task = NULL; /*Task of the periodic events*/
+
+    /*Check input*/
+    if ((priority < TASK_MAX_TASKS) && (NULL != TASK_tasks[priority].task_func))
+    {
+        task = &TASK_tasks[priority];
+        Driver_TIMER_stop(&task->periodic_timer);
+        task->periodic_events = events;
+
+        if ((0 != events) && (0 != period_ticks))
+        {
+            Driver_TIMER_start(&task->periodic_timer, period_ticks, period_ticks, TASK_periodic_IRQ, task);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TASK_run
+* Description: The ready bitmap is checked with the interrupts masked, so a
+*              post between the check and WFI still wakes the core up. The
+*              lowest set bit is the ready task of highest priority.
+*
+END***************************************************************************/
+void Driver_TASK_run(void)
+{
+    TASK_info *task = NULL;     /*Task to run*/
+    uint32_t ready = 0;         /*Ready bitmap*/
+    uint32_t events = 0;        /*Events of the task to run*/
+    uint32_t primask = 0;       /*Interrupt mask of the caller*/
+
+    while (1)
+    {
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+        ready = TASK_ready;
+
+        if (0 == ready)
+        {
+            /*The interrupt waking the core up runs once PRIMASK is restored*/
+            HAL_CORE_wait_for_IRQ();
+            HAL_CORE_PRIMASK_restore(primask);
+        }
+        else
+        {
+            task = &TASK_tasks[TASK_debruijn_table[((ready & (0u - ready)) * TASK_DEBRUIJN) >> 27u]];
+            events = task->events;
+            task->events = 0;
+            TASK_ready &= ~(task->bit);
+
+            /*The events posted until the end of the limit wait for the release*/
+            if (0 != task->min_interval)
+            {
+                TASK_held |= task->bit;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            HAL_CORE_PRIMASK_restore(primask);
+
+            if (0 != task->min_interval)
+            {
+                Driver_TIMER_start(&task->hold_timer, task->min_interval, 0, TASK_release_IRQ, task);
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            task->task_func(task->context, events);
+        }
+    }
+
+    return;
+}
+/*EOF*/
@@ -0,0 +1,536 @@
+/**
+ * @file  : Driver_TIMER.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_TIMER.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_CORE.h"
+#include "../Includes/Driver/Driver_TIMER.h"
+#include "../Includes/Driver/Driver_PIT.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TIMER_SLOT_MASK (TIMER_WHEEL_SLOTS - 1u)    /*Mask of the slot index in a tick*/
+#define TIMER_DEBRUIJN (0x077CB531u)                /*De Bruijn sequence of the trailing zero count*/
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static TIMER_link_info TIMER_wheel[TIMER_WHEEL_SLOTS];  /*Head of the timer list of each slot*/
+static uint32_t TIMER_slot_bitmap = 0;                  /*Bit n is set while slot n has a timer*/
+
+static uint8_t TIMER_index = 0;         /*PIT timer of the service*/
+static uint32_t TIMER_tick_counts = 0;  /*Length of a tick in PIT counts, 0 before init*/
+static uint32_t TIMER_now = 0;          /*Tick at which the running PIT interval started*/
+static uint32_t TIMER_interval = 0;     /*Ticks of the running PIT interval, 0 while the PIT is stopped*/
+static uint32_t TIMER_running_load = 0; /*Load value of the running PIT interval*/
+static uint32_t TIMER_offset = 0;       /*PIT counts from the start of the interval to the last PIT restart*/
+static uint8_t TIMER_in_IRQ = 0;        /*The expiries are being processed, the PIT is loaded at the end*/
+
+/*Bit index of a single set bit, indexed by the top 5 bits of the bit times the De Bruijn sequence*/
+static const uint8_t TIMER_debruijn_table[32] = {
+    0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+    31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u,
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Link a timer in the slot of its expiry
+ *
+ * @param timer is the timer to link
+ *
+ * @return: this function return nothing.
+ */
+static void TIMER_link(TIMER_info *timer);
+
+/**
+ * @brief Unlink a timer from the list it is in
+ *
+ * @param timer is the timer to unlink
+ *
+ * @return: this function return nothing.
+ */
+static void TIMER_unlink(TIMER_info *timer);
+
+/**
+ * @brief Get the distance to the next occupied slot
+ *
+ * @param: This function has no parameter.
+ *
+ * @return the number of ticks from TIMER_now to the next occupied slot (1 to TIMER_WHEEL_SLOTS), 0 if no
+ * slot has a timer.
+ */
+static uint32_t TIMER_next_slot(void);
+
+/**
+ * @brief Restart the PIT timer to time out a number of ticks after the start of the interval
+ *
+ * @param ticks is the length of the interval in ticks (1 to TIMER_WHEEL_SLOTS)
+ * @param elapsed is the number of PIT counts already elapsed in the interval
+ *
+ * @return: this function return nothing.
+ */
+static void TIMER_program(uint32_t ticks, uint32_t elapsed);
+
+/**
+ * @brief PIT interrupt of the service, run the timers of the slot reached
+ *
+ * @param context is not used
+ *
+ * @return: this function return nothing.
+ */
+static void TIMER_IRQ(void *context);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: TIMER_link
+* Description: The timer is put first in the list of its slot
+*
+END***************************************************************************/
+static void TIMER_link(TIMER_info *timer)
+{
+    uint32_t slot = timer->expiry & TIMER_SLOT_MASK;    /*Slot of the expiry*/
+
+    timer->link.next = TIMER_wheel[slot].next;
+    timer->link.prev = &TIMER_wheel[slot];
+    TIMER_wheel[slot].next->prev = &timer->link;
+    TIMER_wheel[slot].next = &timer->link;
+    TIMER_slot_bitmap |= (1u << slot);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: TIMER_unlink
+* Description: The lists are circular, so the timer is unlinked without
+*              knowing its list head
+*
+END***************************************************************************/
+static void TIMER_unlink(TIMER_info *timer)
+{
+    uint32_t slot = timer->expiry & TIMER_SLOT_MASK;    /*Slot of the expiry*/
+
+    timer->link.prev->next = timer->link.next;
+    timer->link.next->prev = timer->link.prev;
+    timer->link.next = NULL;
+    timer->link.prev = NULL;
+
+    if (TIMER_wheel[slot].next == &TIMER_wheel[slot])
+    {
+        TIMER_slot_bitmap &= ~(1u << slot);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: TIMER_next_slot
+* Description: The bitmap is rotated so that bit 0 is the slot after
+*              TIMER_now, its lowest set bit is the next occupied slot
+*
+END***************************************************************************/
+static uint32_t TIMER_next_slot(void)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+    uint32_t shift = 0;     /*Slot after TIMER_now*/
+    uint32_t rotated = 0;   /*Bitmap starting at the slot after TIMER_now*/
+
+    if (0 != TIMER_slot_bitmap)
+    {
+        shift = (TIMER_now + 1u) & TIMER_SLOT_MASK;
+        rotated = (0 == shift) ? TIMER_slot_bitmap :
+                                 ((TIMER_slot_bitmap >> shift) | (TIMER_slot_bitmap << (TIMER_WHEEL_SLOTS - shift)));
+        ret_val = TIMER_debruijn_table[((rotated & (0u - rotated)) * TIMER_DEBRUIJN) >> 27u] + 1u;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: TIMER_program
+* Description: The load value is pipelined, the PIT is restarted so that it
+*              takes the new interval at once. An interval already over
+*              times out on the next count.
+*
+END***************************************************************************/
+static void TIMER_program(uint32_t ticks, uint32_t elapsed)
+{
+    uint32_t counts = ticks * TIMER_tick_counts;    /*Length of the interval in PIT counts*/
+
+    TIMER_running_load = (counts > (elapsed + 1u)) ? (counts - 1u - elapsed) : 0u;
+    TIMER_offset = (counts > (elapsed + 1u)) ? elapsed : (counts - 1u);
+    TIMER_interval = ticks;
+
+    Driver_PIT_select_Timer_state(TIMER_index, TIMER_DISABLED);
+    Driver_PIT_set_load_value(TIMER_index, TIMER_running_load);
+    Driver_PIT_select_Timer_state(TIMER_index, TIMER_ENABLED);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: TIMER_IRQ
+* Description: Only the timers of the slot reached are looked at. The due
+*              ones are moved to a local list first, so a callback can start
+*              or stop any timer.
+*
+END***************************************************************************/
+static void TIMER_IRQ(void *context)
+{
+    TIMER_link_info expired = {NULL, NULL}; /*Head of the list of the due timers*/
+    TIMER_link_info *link = NULL;           /*Timer looked at*/
+    TIMER_link_info *next = NULL;           /*Timer after it*/
+    TIMER_info *timer = NULL;               /*Due timer*/
+    uint32_t slot = 0;                      /*Slot reached*/
+    uint32_t ticks = 0;                     /*Ticks to the next occupied slot*/
+
+    (void)context;
+
+    TIMER_now += TIMER_interval;
+    TIMER_in_IRQ = 1;
+    slot = TIMER_now & TIMER_SLOT_MASK;
+    expired.next = &expired;
+    expired.prev = &expired;
+
+    /*The slot also holds the timers of the next turns of the wheel*/
+    link = TIMER_wheel[slot].next;
+    while (link != &TIMER_wheel[slot])
+    {
+        next = link->next;
+        timer = (TIMER_info *)link;
+
+        /*A timer whose slot was reached late is due as well*/
+        if ((int32_t)(TIMER_now - timer->expiry) >= 0)
+        {
+            TIMER_unlink(timer);
+            timer->link.next = &expired;
+            timer->link.prev = expired.prev;
+            expired.prev->next = &timer->link;
+            expired.prev = &timer->link;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        link = next;
+    }
+
+    while (expired.next != &expired)
+    {
+        timer = (TIMER_info *)expired.next;
+        TIMER_unlink(timer);
+
+        /*A periodic timer is linked again before its callback, which can stop it*/
+        if (0 != timer->period)
+        {
+            timer->expiry = TIMER_now + timer->period;
+            TIMER_link(timer);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        timer->callback_func(timer->context);
+    }
+
+    TIMER_in_IRQ = 0;
+
+    /*The PIT reloaded the interval at the timeout, the counts since then are not lost*/
+    ticks = TIMER_next_slot();
+    if (0 != ticks)
+    {
+        TIMER_program(ticks, TIMER_running_load - Driver_PIT_read_current_value(TIMER_index));
+    }
+    else
+    {
+        Driver_PIT_select_Timer_state(TIMER_index, TIMER_DISABLED);
+        TIMER_interval = 0;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TIMER_init
+* Description: Init the software timer service and register its PIT
+*              interrupt, the PIT starts with the first timer
+*
+END***************************************************************************/
+void Driver_TIMER_init(TIMER_config_info *TIMER_config)
+{
+    uint32_t slot = 0;              /*Slot index*/
+    uint32_t primask = 0;           /*Interrupt mask of the caller*/
+    TIMER_link_info *link = NULL;   /*Timer dropped*/
+
+    /*PIT configuration info*/
+    PIT_config_info PIT_config = {
+        .MCR_config.freeze_mode = TIMERS_STOPPED_IN_DEBUG,
+        .MCR_config.module_state = PIT_ENABLED,
+        .TCTRLn_config.timer_state = TIMER_DISABLED,
+        .TCTRLn_config.chain_mode = CHAIN_MODE_DISABLED,
+        .TCTRLn_config.IRQ_state = IRQ_ENABLED,
+        .load_value = 0,
+    };
+
+    /*Check input, the longest interval is a turn of the wheel*/
+    if ((NULL != TIMER_config) && (TIMER_config->timer_index <= 1) && (0 != TIMER_config->tick_counts) &&
+        (TIMER_config->tick_counts <= (0xFFFFFFFFu / TIMER_WHEEL_SLOTS)))
+    {
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+        /*The timers of a previous init are marked stopped*/
+        for (slot = 0; slot < TIMER_WHEEL_SLOTS; slot++)
+        {
+            while ((NULL != TIMER_wheel[slot].next) && (TIMER_wheel[slot].next != &TIMER_wheel[slot]))
+            {
+                link = TIMER_wheel[slot].next;
+                TIMER_wheel[slot].next = link->next;
+                link->next = NULL;
+                link->prev = NULL;
+            }
+
+            TIMER_wheel[slot].next = &TIMER_wheel[slot];
+            TIMER_wheel[slot].prev = &TIMER_wheel[slot];
+        }
+
+        if ((0 != TIMER_tick_counts) && (TIMER_config->timer_index != TIMER_index))
+        {
+            Driver_PIT_select_Timer_state(TIMER_index, TIMER_DISABLED);
+            Driver_PIT_register_callabck(TIMER_index, NULL, NULL);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        TIMER_slot_bitmap = 0;
+        TIMER_index = TIMER_config->timer_index;
+        TIMER_tick_counts = TIMER_config->tick_counts;
+        TIMER_now = 0;
+        TIMER_interval = 0;
+        TIMER_in_IRQ = 0;
+
+        PIT_config.TCTRLn_config.timer_index = TIMER_index;
+        Driver_PIT_register_callabck(TIMER_index, TIMER_IRQ, NULL);
+        Driver_PIT_init(&PIT_config);
+
+        HAL_CORE_PRIMASK_restore(primask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TIMER_start
+* Description: The current tick is taken from the PIT counter. If the
+*              timer expires before the running interval ends, the PIT is
+*              restarted with the shorter interval. A timeout not serviced
+*              yet or a callback leaves it to the interrupt. The counter is
+*              read before the flag: a timeout between the two reads shows
+*              as a set flag, not as a count of the reloaded interval.
+*
+END***************************************************************************/
+void Driver_TIMER_start(TIMER_info *timer, uint32_t delay_ticks, uint32_t period_ticks, callback callback_func,
+                        void *context)
+{
+    uint32_t elapsed = 0;   /*PIT counts elapsed in the running interval*/
+    uint32_t current = 0;   /*PIT current value*/
+    uint32_t now = 0;       /*Current tick*/
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+    uint8_t reload = 0;     /*The PIT is restarted with the interval to the expiry*/
+
+    /*Check input*/
+    if ((NULL != timer) && (NULL != callback_func) && (0 != TIMER_tick_counts) && (0 != delay_ticks) &&
+        (delay_ticks <= TIMER_MAX_DELAY_TICKS) && (period_ticks <= TIMER_MAX_DELAY_TICKS))
+    {
+        /*A short critical section, the other PIT timer keeps its interrupt priority*/
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+        if (NULL != timer->link.next)
+        {
+            TIMER_unlink(timer);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        current = Driver_PIT_read_current_value(TIMER_index);
+
+        if (1 == TIMER_in_IRQ)
+        {
+            now = TIMER_now;
+        }
+        else if (0 == TIMER_interval)
+        {
+            now = TIMER_now;
+            reload = 1;
+        }
+        else if (1 == Driver_PIT_read_IRQ_flag(TIMER_index))
+        {
+            now = TIMER_now + TIMER_interval;
+        }
+        else
+        {
+            elapsed = TIMER_offset + (TIMER_running_load - current);
+            now = TIMER_now + (elapsed / TIMER_tick_counts);
+            reload = (uint8_t)((now + delay_ticks - TIMER_now) < TIMER_interval);
+        }
+
+        timer->expiry = now + delay_ticks;
+        timer->period = period_ticks;
+        timer->callback_func = callback_func;
+        timer->context = context;
+        TIMER_link(timer);
+
+        if (1 == reload)
+        {
+            TIMER_program((delay_ticks < TIMER_WHEEL_SLOTS) ? (timer->expiry - TIMER_now) : TIMER_WHEEL_SLOTS,
+                          elapsed);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        HAL_CORE_PRIMASK_restore(primask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TIMER_stop
+* Description: The PIT keeps its interval, a timeout on an empty slot only
+*              loads the next one
+*
+END***************************************************************************/
+void Driver_TIMER_stop(TIMER_info *timer)
+{
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+
+    /*Check input*/
+    if ((NULL != timer) && (0 != TIMER_tick_counts))
+    {
+        primask = HAL_CORE_PRIMASK_disable_IRQ();
+
+        if (NULL != timer->link.next)
+        {
+            TIMER_unlink(timer);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        HAL_CORE_PRIMASK_restore(primask);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TIMER_is_running
+* Description: Check if a software timer is linked in the wheel
+*
+END***************************************************************************/
+uint8_t Driver_TIMER_is_running(TIMER_info *timer)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    /*Check input*/
+    if ((NULL != timer) && (NULL != timer->link.next))
+    {
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TIMER_read_ticks
+* Description: Add the ticks elapsed in the running interval to the tick
+*              at which it started, the counter is read before the flag
+*
+END***************************************************************************/
+uint32_t Driver_TIMER_read_ticks(void)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+    uint32_t current = 0;   /*PIT current value*/
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+
+    primask = HAL_CORE_PRIMASK_disable_IRQ();
+    current = Driver_PIT_read_current_value(TIMER_index);
+
+    if ((0 == TIMER_tick_counts) || (0 == TIMER_interval) || (1 == TIMER_in_IRQ))
+    {
+        ret_val = TIMER_now;
+    }
+    else if (1 == Driver_PIT_read_IRQ_flag(TIMER_index))
+    {
+        ret_val = TIMER_now + TIMER_interval;
+    }
+    else
+    {
+        ret_val = TIMER_now + ((TIMER_offset + (TIMER_running_load - current)) / TIMER_tick_counts);
+    }
+
+    HAL_CORE_PRIMASK_restore(primask);
+
+    return ret_val;
+}
+/*EOF*/
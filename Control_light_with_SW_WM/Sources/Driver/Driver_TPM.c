@@ -0,0 +1,252 @@
+/**
+ * @file  : Driver_TPM.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file Driver_TPM.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_TPM.h"
+#include "../Includes/Driver/Driver_TPM.h"
+#include "../Includes/Driver/Driver_SIM.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*This array stores all the TPM modules*/
+static TPM_Type *TPM_array[TPM_MODULE_COUNT] = {TPM0, TPM1, TPM2};
+
+/*This array stores the number of channels of each TPM module*/
+static const uint8_t TPM_channel_count[TPM_MODULE_COUNT] = {6u, 2u, 2u};
+
+/*This array stores the pins which have a TPM channel, the SWD pins PTA0 and PTA3 are left out*/
+static const TPM_pin_route_info TPM_pin_routes[] = {
+    {PORT_A, 1u, 2u, 0u, MUX_ALTERNATIVE3},
+    {PORT_A, 2u, 2u, 1u, MUX_ALTERNATIVE3},
+    {PORT_A, 4u, 0u, 1u, MUX_ALTERNATIVE3},
+    {PORT_A, 5u, 0u, 2u, MUX_ALTERNATIVE3},
+    {PORT_A, 12u, 1u, 0u, MUX_ALTERNATIVE3},
+    {PORT_A, 13u, 1u, 1u, MUX_ALTERNATIVE3},
+    {PORT_B, 0u, 1u, 0u, MUX_ALTERNATIVE3},
+    {PORT_B, 1u, 1u, 1u, MUX_ALTERNATIVE3},
+    {PORT_B, 2u, 2u, 0u, MUX_ALTERNATIVE3},
+    {PORT_B, 3u, 2u, 1u, MUX_ALTERNATIVE3},
+    {PORT_B, 18u, 2u, 0u, MUX_ALTERNATIVE3},
+    {PORT_B, 19u, 2u, 1u, MUX_ALTERNATIVE3},
+    {PORT_C, 1u, 0u, 0u, MUX_ALTERNATIVE4},
+    {PORT_C, 2u, 0u, 1u, MUX_ALTERNATIVE4},
+    {PORT_C, 3u, 0u, 2u, MUX_ALTERNATIVE4},
+    {PORT_C, 4u, 0u, 3u, MUX_ALTERNATIVE4},
+    {PORT_C, 8u, 0u, 4u, MUX_ALTERNATIVE3},
+    {PORT_C, 9u, 0u, 5u, MUX_ALTERNATIVE3},
+    {PORT_D, 0u, 0u, 0u, MUX_ALTERNATIVE4},
+    {PORT_D, 1u, 0u, 1u, MUX_ALTERNATIVE4},
+    {PORT_D, 2u, 0u, 2u, MUX_ALTERNATIVE4},
+    {PORT_D, 3u, 0u, 3u, MUX_ALTERNATIVE4},
+    {PORT_D, 4u, 0u, 4u, MUX_ALTERNATIVE4},
+    {PORT_D, 5u, 0u, 5u, MUX_ALTERNATIVE4},
+    {PORT_E, 20u, 1u, 0u, MUX_ALTERNATIVE3},
+    {PORT_E, 21u, 1u, 1u, MUX_ALTERNATIVE3},
+    {PORT_E, 22u, 2u, 0u, MUX_ALTERNATIVE3},
+    {PORT_E, 23u, 2u, 1u, MUX_ALTERNATIVE3},
+    {PORT_E, 24u, 0u, 0u, MUX_ALTERNATIVE3},
+    {PORT_E, 25u, 0u, 1u, MUX_ALTERNATIVE3},
+    {PORT_E, 29u, 0u, 2u, MUX_ALTERNATIVE3},
+    {PORT_E, 30u, 0u, 3u, MUX_ALTERNATIVE3},
+    {PORT_E, 31u, 0u, 4u, MUX_ALTERNATIVE3},
+};
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_init
+* Description: Init a TPM module in up counting mode and start its counter
+*
+END***************************************************************************/
+void Driver_TPM_init(TPM_config_info *TPM_config)
+{
+    /*Check input*/
+    if ((NULL != TPM_config) && (TPM_config->TPM_index < TPM_MODULE_COUNT) &&
+        (TPM_config->prescaler <= TPM_MAX_PRESCALER) && (TPM_config->modulo <= TPM_MAX_MODULO))
+    {
+        /*Enable the module clock and the TPM counter clock*/
+        Driver_SIM_set_TPM_clock(TPM_config->TPM_index, ENABLED);
+        Driver_SIM_select_TPM_clock_source(TPM_CLOCK_MCGFLLCLK);
+
+        /*The prescaler can only be written while the counter is disabled, the disable is acknowledged
+          in the counter clock domain*/
+        HAL_TPM_SC_set_CMOD(TPM_array[TPM_config->TPM_index], 0u);
+        while (0u != HAL_TPM_SC_read_CMOD(TPM_array[TPM_config->TPM_index]))
+        {
+        }
+        HAL_TPM_SC_set_PS(TPM_array[TPM_config->TPM_index], TPM_config->prescaler);
+        HAL_TPM_MOD_set_MOD(TPM_array[TPM_config->TPM_index], TPM_config->modulo);
+
+        /*Count on the TPM clock*/
+        HAL_TPM_SC_set_CMOD(TPM_array[TPM_config->TPM_index], 1u);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_stop
+* Description: Stop the counter of a TPM module
+*
+END***************************************************************************/
+void Driver_TPM_stop(uint8_t TPM_index)
+{
+    /*Check TPM index*/
+    if (TPM_index < TPM_MODULE_COUNT)
+    {
+        /*The counter stops once the disable is acknowledged in the counter clock domain*/
+        HAL_TPM_SC_set_CMOD(TPM_array[TPM_index], 0u);
+        while (0u != HAL_TPM_SC_read_CMOD(TPM_array[TPM_index]))
+        {
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_set_modulo
+* Description: Set the modulo of a TPM module
+*
+END***************************************************************************/
+void Driver_TPM_set_modulo(uint8_t TPM_index, uint16_t modulo)
+{
+    /*Check input*/
+    if ((TPM_index < TPM_MODULE_COUNT) && (modulo <= TPM_MAX_MODULO))
+    {
+        HAL_TPM_MOD_set_MOD(TPM_array[TPM_index], modulo);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_config_channel
+* Description: Set the mode of a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_config_channel(uint8_t TPM_index, uint8_t channel, TPM_channel_mode_enum_t mode)
+{
+    /*Check input*/
+    if ((TPM_index < TPM_MODULE_COUNT) && (channel < TPM_channel_count[TPM_index]))
+    {
+        HAL_TPM_CnSC_set_mode(TPM_array[TPM_index], channel, (uint8_t)mode);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_set_channel_value
+* Description: Set the match value of a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_set_channel_value(uint8_t TPM_index, uint8_t channel, uint16_t value)
+{
+    /*Check input*/
+    if ((TPM_index < TPM_MODULE_COUNT) && (channel < TPM_channel_count[TPM_index]))
+    {
+        HAL_TPM_CnV_set_VAL(TPM_array[TPM_index], channel, value);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_read_counter
+* Description: Read the counter of a TPM module
+*
+END***************************************************************************/
+uint16_t Driver_TPM_read_counter(uint8_t TPM_index)
+{
+    uint16_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    /*Check TPM index*/
+    if (TPM_index < TPM_MODULE_COUNT)
+    {
+        ret_val = HAL_TPM_CNT_read_COUNT(TPM_array[TPM_index]);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_find_pin_route
+* Description: Look for a pin in the TPM pin routing table
+*
+END***************************************************************************/
+uint8_t Driver_TPM_find_pin_route(Port_type_enum_t port_type, uint8_t pin, TPM_pin_route_info *route)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+    uint8_t index = 0;      /*Index in the routing table*/
+
+    /*Check input*/
+    if (NULL != route)
+    {
+        for (index = 0; (index < (sizeof(TPM_pin_routes) / sizeof(TPM_pin_routes[0]))) && (0 == ret_val); index++)
+        {
+            if ((port_type == TPM_pin_routes[index].port_type) && (pin == TPM_pin_routes[index].pin))
+            {
+                *route = TPM_pin_routes[index];
+                ret_val = 1;
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+/*EOF*/
@@ -0,0 +1,77 @@
+/**
+ * @file  : HAL_CORE.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file HAL_CORE.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- PRIMASK register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_PRIMASK_disable_IRQ.
+* Description: Save PRIMASK, then mask all the interrupts
+*
+END***************************************************************************/
+uint32_t HAL_CORE_PRIMASK_disable_IRQ(void)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    ret_val = __get_PRIMASK();
+    __disable_irq();
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_PRIMASK_restore.
+* Description: Write back the PRIMASK value of the caller
+*
+END***************************************************************************/
+void HAL_CORE_PRIMASK_restore(uint32_t primask)
+{
+    /*Write the PRIMASK register*/
+    __set_PRIMASK(primask);
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group PRIMASK register functions */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_wait_for_IRQ.
+* Description: Clear SLEEPDEEP so that WFI enters sleep mode, not deep sleep
+*
+END***************************************************************************/
+void HAL_CORE_wait_for_IRQ(void)
+{
+    /*Write 0 to the SLEEPDEEP bit field*/
+    SCB->SCR &= ~(SCB_SCR_SLEEPDEEP_Msk);
+    __WFI();
+
+    return;
+}
+/*EOF*/
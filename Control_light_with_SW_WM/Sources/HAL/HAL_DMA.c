@@ -0,0 +1,260 @@
+/**
+ * @file  : HAL_DMA.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file HAL_DMA.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- SARn and DARn register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_SARn_set_SAR.
+* Description: Set the source address of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_SARn_set_SAR(uint8_t channel, uint32_t SAR_value)
+{
+    /*Write the source address*/
+    DMA0->DMA[channel].SAR = SAR_value;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_SARn_read_SAR.
+* Description: Read the source address of DMA channel n
+*
+END***************************************************************************/
+uint32_t HAL_DMA_SARn_read_SAR(uint8_t channel)
+{
+    /*Read the source address, it moves after each transfer*/
+    return DMA0->DMA[channel].SAR;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DARn_set_DAR.
+* Description: Set the destination address of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DARn_set_DAR(uint8_t channel, uint32_t DAR_value)
+{
+    /*Write the destination address*/
+    DMA0->DMA[channel].DAR = DAR_value;
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group SARn and DARn register functions */
+
+/* ----------------------------------------------------------------------------
+   -- DSR_BCRn register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DSR_BCRn_set_BCR.
+* Description: Set the byte count of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DSR_BCRn_set_BCR(uint8_t channel, uint32_t BCR_value)
+{
+    /*Write the BCR bit field, the status bits are not changed by writing 0*/
+    DMA0->DMA[channel].DSR_BCR = DMA_DSR_BCR_BCR(BCR_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DSR_BCRn_set_DONE.
+* Description: Write 1 to DONE to clear the done and error flags of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DSR_BCRn_set_DONE(uint8_t channel)
+{
+    /*Write 1 to the DONE bit field through the 8-bit DSR access, BCR is not changed*/
+    DMA0->DMA[channel].DMA_DSR_ACCESS8BIT.DSR = (uint8_t)(DMA_DSR_BCR_DONE_MASK >> 24u);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DSR_BCRn_read_DONE.
+* Description: Read the done flag of DMA channel n
+*
+END***************************************************************************/
+uint8_t HAL_DMA_DSR_BCRn_read_DONE(uint8_t channel)
+{
+    /*Read the DONE bit field*/
+    return (uint8_t)((DMA0->DMA[channel].DSR_BCR & DMA_DSR_BCR_DONE_MASK) >> DMA_DSR_BCR_DONE_SHIFT);
+}
+
+/*!
+ * @}
+ */ /* end of group DSR_BCRn register functions */
+
+/* ----------------------------------------------------------------------------
+   -- DCRn register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_transfer.
+* Description: Set the data size and address increments of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_transfer(uint8_t channel, uint8_t size_value, uint8_t SINC_value, uint8_t DINC_value)
+{
+    /*Write the SSIZE, DSIZE, SINC and DINC bit fields*/
+    DMA0->DMA[channel].DCR = (DMA0->DMA[channel].DCR &
+                              ~(DMA_DCR_SSIZE_MASK | DMA_DCR_DSIZE_MASK | DMA_DCR_SINC_MASK | DMA_DCR_DINC_MASK)) |
+                             DMA_DCR_SSIZE(size_value) | DMA_DCR_DSIZE(size_value) |
+                             DMA_DCR_SINC(SINC_value) | DMA_DCR_DINC(DINC_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_SMOD.
+* Description: Set the source address modulo of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_SMOD(uint8_t channel, uint8_t SMOD_value)
+{
+    /*Write the SMOD bit field*/
+    DMA0->DMA[channel].DCR = (DMA0->DMA[channel].DCR & ~(DMA_DCR_SMOD_MASK)) | DMA_DCR_SMOD(SMOD_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_CS.
+* Description: Set cycle steal or continuous transfer of DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_CS(uint8_t channel, uint8_t CS_value)
+{
+    /*If one transfer is done per request*/
+    if (1 == CS_value)
+    {
+        /*Write 1 to the CS bit field*/
+        DMA0->DMA[channel].DCR |= DMA_DCR_CS_MASK;
+    }
+    /*If the whole byte count is transferred at once*/
+    else
+    {
+        /*Write 0 to the CS bit field*/
+        DMA0->DMA[channel].DCR &= ~(DMA_DCR_CS_MASK);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_link.
+* Description: Set the channel linked to DMA channel n
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_link(uint8_t channel, uint8_t LINKCC_value, uint8_t LCH1_value)
+{
+    /*Write the LINKCC and LCH1 bit fields*/
+    DMA0->DMA[channel].DCR = (DMA0->DMA[channel].DCR & ~(DMA_DCR_LINKCC_MASK | DMA_DCR_LCH1_MASK)) |
+                             DMA_DCR_LINKCC(LINKCC_value) | DMA_DCR_LCH1(LCH1_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_ERQ.
+* Description: Set the peripheral request of DMA channel n enabled or disabled
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_ERQ(uint8_t channel, uint8_t ERQ_value)
+{
+    /*If peripheral requests start transfers*/
+    if (1 == ERQ_value)
+    {
+        /*Write 1 to the ERQ bit field*/
+        DMA0->DMA[channel].DCR |= DMA_DCR_ERQ_MASK;
+    }
+    /*If peripheral requests are ignored*/
+    else
+    {
+        /*Write 0 to the ERQ bit field*/
+        DMA0->DMA[channel].DCR &= ~(DMA_DCR_ERQ_MASK);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMA_DCRn_set_EINT.
+* Description: Set the interrupt of DMA channel n enabled or disabled
+*
+END***************************************************************************/
+void HAL_DMA_DCRn_set_EINT(uint8_t channel, uint8_t EINT_value)
+{
+    /*If the end of the transfer sends an interrupt request*/
+    if (1 == EINT_value)
+    {
+        /*Write 1 to the EINT bit field*/
+        DMA0->DMA[channel].DCR |= DMA_DCR_EINT_MASK;
+    }
+    /*If the end of the transfer sends no interrupt request*/
+    else
+    {
+        /*Write 0 to the EINT bit field*/
+        DMA0->DMA[channel].DCR &= ~(DMA_DCR_EINT_MASK);
+    }
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group DCRn register bit setting functions */
+
+/*Function*********************************************************************
+*
+* Function name: HAL_DMA_enable_IRQ_Handler.
+* Description: Enable the interrupt handler of DMA channel n.
+*
+END***************************************************************************/
+void HAL_DMA_enable_IRQ_Handler(uint8_t channel)
+{
+    /*Enable the DMA channel n interrupt handler*/
+    NVIC_EnableIRQ((IRQn_Type)((uint8_t)DMA0_IRQn + channel));
+
+    return;
+}
+/*EOF*/
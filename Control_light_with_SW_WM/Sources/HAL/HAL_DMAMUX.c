@@ -0,0 +1,95 @@
+/**
+ * @file  : HAL_DMAMUX.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file HAL_DMAMUX.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "MKL46Z4.h"
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- CHCFGn register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMAMUX_CHCFGn_set_ENBL.
+* Description: Set DMAMUX channel n enabled or disabled
+*
+END***************************************************************************/
+void HAL_DMAMUX_CHCFGn_set_ENBL(uint8_t channel, uint8_t ENBL_value)
+{
+    /*If the DMA channel is routed*/
+    if (1 == ENBL_value)
+    {
+        /*Write 1 to the ENBL bit field*/
+        DMAMUX0->CHCFG[channel] |= DMAMUX_CHCFG_ENBL_MASK;
+    }
+    /*If the DMA channel is not routed*/
+    else
+    {
+        /*Write 0 to the ENBL bit field*/
+        DMAMUX0->CHCFG[channel] &= (uint8_t)~(DMAMUX_CHCFG_ENBL_MASK);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMAMUX_CHCFGn_set_TRIG.
+* Description: Set the PIT trigger of DMAMUX channel n enabled or disabled
+*
+END***************************************************************************/
+void HAL_DMAMUX_CHCFGn_set_TRIG(uint8_t channel, uint8_t TRIG_value)
+{
+    /*If the request is passed at each PIT timeout*/
+    if (1 == TRIG_value)
+    {
+        /*Write 1 to the TRIG bit field*/
+        DMAMUX0->CHCFG[channel] |= DMAMUX_CHCFG_TRIG_MASK;
+    }
+    /*If the request is passed directly*/
+    else
+    {
+        /*Write 0 to the TRIG bit field*/
+        DMAMUX0->CHCFG[channel] &= (uint8_t)~(DMAMUX_CHCFG_TRIG_MASK);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_DMAMUX_CHCFGn_set_SOURCE.
+* Description: Select the request source of DMAMUX channel n
+*
+END***************************************************************************/
+void HAL_DMAMUX_CHCFGn_set_SOURCE(uint8_t channel, uint8_t SOURCE_value)
+{
+    /*Write the SOURCE bit field*/
+    DMAMUX0->CHCFG[channel] = (uint8_t)((DMAMUX0->CHCFG[channel] & ~(DMAMUX_CHCFG_SOURCE_MASK)) |
+                                        DMAMUX_CHCFG_SOURCE(SOURCE_value));
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group CHCFGn register bit setting functions */
+/*EOF*/
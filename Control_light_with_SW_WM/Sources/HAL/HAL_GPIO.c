@@ -131,4 +131,90 @@ void HAL_GPIO_toggle_PIN(GPIO_Type *port, int8_t pin)
 
     return;
 }
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_GPIO_set_PORT.
+* Description: Set the pins of a port given by a mask.
+*
+END***************************************************************************/
+void HAL_GPIO_set_PORT(GPIO_Type *port, uint32_t pin_mask)
+{
+    if (NULL != port)
+    {
+        /*Write 1 to PSORn, the other pins are not changed*/
+        port->PSOR = pin_mask;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_GPIO_clear_PORT.
+* Description: Clear the pins of a port given by a mask.
+*
+END***************************************************************************/
+void HAL_GPIO_clear_PORT(GPIO_Type *port, uint32_t pin_mask)
+{
+    if (NULL != port)
+    {
+        /*Write 1 to PCORn, the other pins are not changed*/
+        port->PCOR = pin_mask;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_GPIO_get_PSOR_address.
+* Description: Get the address of the set output register of a port.
+*
+END***************************************************************************/
+uint32_t HAL_GPIO_get_PSOR_address(GPIO_Type *port)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (NULL != port)
+    {
+        ret_val = (uint32_t)&(port->PSOR);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_GPIO_get_PCOR_address.
+* Description: Get the address of the clear output register of a port.
+*
+END***************************************************************************/
+uint32_t HAL_GPIO_get_PCOR_address(GPIO_Type *port)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (NULL != port)
+    {
+        ret_val = (uint32_t)&(port->PCOR);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
 /*EOF*/
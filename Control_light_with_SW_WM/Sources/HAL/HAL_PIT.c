@@ -124,6 +124,46 @@ void HAL_PIT_LDVALn_set_TSV(uint8_t timer_index, uint32_t TSV_value)
  * @}
  */ /* end of group LDVALn register functions */
 
+/* ----------------------------------------------------------------------------
+   -- CVALn register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_CVALn_read_TVL.
+* Description: Read current value of timer n
+*
+END***************************************************************************/
+uint32_t HAL_PIT_CVALn_read_TVL(uint8_t timer_index)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    /*Check timer index*/
+    switch (timer_index)
+    {
+    case 0:
+    {
+        /*Read the current value*/
+        ret_val = PIT_CVAL0;
+        break;
+    }
+    case 1:
+    {
+        /*Read the current value*/
+        ret_val = PIT_CVAL1;
+        break;
+    }
+    default:
+        break;
+    }
+
+    return ret_val;
+}
+
+/*!
+ * @}
+ */ /* end of group CVALn register functions */
+
  /* ----------------------------------------------------------------------------
    -- TCTRLn register bit setting functions group
    ---------------------------------------------------------------------------- */
@@ -358,6 +398,37 @@ void HAL_PIT_TFLGn_set_TIF(uint8_t timer_index)
  * @}
  */ /* end of group TFLGn register bit setting functions */
 
+/* ----------------------------------------------------------------------------
+   -- LTMR64H and LTMR64L register reading functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_LTMR64_read_LT.
+* Description: Read the lifetime timer, the upper word first
+*
+END***************************************************************************/
+uint64_t HAL_PIT_LTMR64_read_LT(void)
+{
+    uint64_t ret_val = 0;   /*This variable stores the return value of the function*/
+    uint32_t primask = 0;   /*Interrupt mask of the caller*/
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    /*Reading LTMR64H latches timer 0 in LTMR64L*/
+    ret_val = (uint64_t)PIT->LTMR64H << 32u;
+    ret_val |= PIT->LTMR64L;
+
+    __set_PRIMASK(primask);
+
+    return ret_val;
+}
+
+/*!
+ * @}
+ */ /* end of group LTMR64H and LTMR64L register reading functions */
+
 /*Function*********************************************************************
 *
 * Function name: HAL_PIT_enable_IRQ_Handler.
@@ -371,4 +442,18 @@ void HAL_PIT_enable_IRQ_Handler(void)
 
     return;
 }
+
+/*Function*********************************************************************
+*
+* Function name: HAL_PIT_disable_IRQ_Handler.
+* Description: Disable the PIT interrupt handler.
+*
+END***************************************************************************/
+void HAL_PIT_disable_IRQ_Handler(void)
+{
+    /*Disable the PIT interrupt handler, a pending request stays pending*/
+    NVIC_DisableIRQ(PIT_IRQn);
+
+    return;
+}
 /*EOF*/
@@ -230,8 +230,222 @@ void HAL_SIM_SCGC6_set_clock_PIT(uint8_t PIT_gate_value)
     return;
 }
 
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SCGC6_set_clock_TPM0
+* Description: Set clock for TPM0.
+*
+END***************************************************************************/
+void HAL_SIM_SCGC6_set_clock_TPM0(uint8_t TPM0_gate_value)
+{
+    /*If TPM0 clock gate is enabled*/
+    if (1 == TPM0_gate_value)
+    {
+        /*Write 1 to the TPM0 bit field*/
+        SIM->SCGC6 |= SIM_SCGC6_TPM0_MASK;
+    }
+    /*If TPM0 clock gate is disabled*/
+    else if (0 == TPM0_gate_value)
+    {
+        /*Write 0 to the TPM0 bit field*/
+        SIM->SCGC6 &= ~(SIM_SCGC6_TPM0_MASK);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SCGC6_set_clock_TPM1
+* Description: Set clock for TPM1.
+*
+END***************************************************************************/
+void HAL_SIM_SCGC6_set_clock_TPM1(uint8_t TPM1_gate_value)
+{
+    /*If TPM1 clock gate is enabled*/
+    if (1 == TPM1_gate_value)
+    {
+        /*Write 1 to the TPM1 bit field*/
+        SIM->SCGC6 |= SIM_SCGC6_TPM1_MASK;
+    }
+    /*If TPM1 clock gate is disabled*/
+    else if (0 == TPM1_gate_value)
+    {
+        /*Write 0 to the TPM1 bit field*/
+        SIM->SCGC6 &= ~(SIM_SCGC6_TPM1_MASK);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SCGC6_set_clock_TPM2
+* Description: Set clock for TPM2.
+*
+END***************************************************************************/
+void HAL_SIM_SCGC6_set_clock_TPM2(uint8_t TPM2_gate_value)
+{
+    /*If TPM2 clock gate is enabled*/
+    if (1 == TPM2_gate_value)
+    {
+        /*Write 1 to the TPM2 bit field*/
+        SIM->SCGC6 |= SIM_SCGC6_TPM2_MASK;
+    }
+    /*If TPM2 clock gate is disabled*/
+    else if (0 == TPM2_gate_value)
+    {
+        /*Write 0 to the TPM2 bit field*/
+        SIM->SCGC6 &= ~(SIM_SCGC6_TPM2_MASK);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SCGC6_set_clock_DMAMUX
+* Description: Set clock for DMAMUX.
+*
+END***************************************************************************/
+void HAL_SIM_SCGC6_set_clock_DMAMUX(uint8_t DMAMUX_gate_value)
+{
+    /*If DMAMUX clock gate is enabled*/
+    if (1 == DMAMUX_gate_value)
+    {
+        /*Write 1 to the DMAMUX bit field*/
+        SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+    }
+    /*If DMAMUX clock gate is disabled*/
+    else if (0 == DMAMUX_gate_value)
+    {
+        /*Write 0 to the DMAMUX bit field*/
+        SIM->SCGC6 &= ~(SIM_SCGC6_DMAMUX_MASK);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
 /*!
  * @}
  */ /* end of group SCGC6 register bit setting function */
 
+/* ----------------------------------------------------------------------------
+   -- SCGC7 register bit setting function group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SCGC7_set_clock_DMA
+* Description: Set clock for DMA.
+*
+END***************************************************************************/
+void HAL_SIM_SCGC7_set_clock_DMA(uint8_t DMA_gate_value)
+{
+    /*If DMA clock gate is enabled*/
+    if (1 == DMA_gate_value)
+    {
+        /*Write 1 to the DMA bit field*/
+        SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+    }
+    /*If DMA clock gate is disabled*/
+    else if (0 == DMA_gate_value)
+    {
+        /*Write 0 to the DMA bit field*/
+        SIM->SCGC7 &= ~(SIM_SCGC7_DMA_MASK);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group SCGC7 register bit setting function */
+
+/* ----------------------------------------------------------------------------
+   -- CLKDIV1 register bit reading function group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_CLKDIV1_read_OUTDIV4
+* Description: Read the bus clock divider.
+*
+END***************************************************************************/
+uint8_t HAL_SIM_CLKDIV1_read_OUTDIV4(void)
+{
+    /*Read the OUTDIV4 bit field*/
+    return (uint8_t)((SIM->CLKDIV1 & SIM_CLKDIV1_OUTDIV4_MASK) >> SIM_CLKDIV1_OUTDIV4_SHIFT);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_CLKDIV1_read_OUTDIV1
+* Description: Read the core clock divider.
+*
+END***************************************************************************/
+uint8_t HAL_SIM_CLKDIV1_read_OUTDIV1(void)
+{
+    /*Read the OUTDIV1 bit field*/
+    return (uint8_t)((SIM->CLKDIV1 & SIM_CLKDIV1_OUTDIV1_MASK) >> SIM_CLKDIV1_OUTDIV1_SHIFT);
+}
+
+/*!
+ * @}
+ */ /* end of group CLKDIV1 register bit reading function */
+
+/* ----------------------------------------------------------------------------
+   -- SOPT2 register bit setting function group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SOPT2_set_TPMSRC
+* Description: Select the clock source of the TPM modules.
+*
+END***************************************************************************/
+void HAL_SIM_SOPT2_set_TPMSRC(uint8_t TPMSRC_value)
+{
+    /*Write the TPMSRC bit field*/
+    SIM->SOPT2 = (SIM->SOPT2 & ~(SIM_SOPT2_TPMSRC_MASK)) | SIM_SOPT2_TPMSRC(TPMSRC_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_SIM_SOPT2_read_PLLFLLSEL
+* Description: Read the FLL or PLL selection of the peripheral clock.
+*
+END***************************************************************************/
+uint8_t HAL_SIM_SOPT2_read_PLLFLLSEL(void)
+{
+    /*Read the PLLFLLSEL bit field*/
+    return (uint8_t)((SIM->SOPT2 & SIM_SOPT2_PLLFLLSEL_MASK) >> SIM_SOPT2_PLLFLLSEL_SHIFT);
+}
+
+/*!
+ * @}
+ */ /* end of group SOPT2 register bit setting function */
+
 /*EOF*/
@@ -0,0 +1,168 @@
+/**
+ * @file  : HAL_TPM.c
+ * @author: Nguyen The Anh.
+ * @brief : Definition of function using in file HAL_TPM.c
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "../Includes/HAL/HAL_TPM.h"
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/* ----------------------------------------------------------------------------
+   -- SC register bit setting functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_SC_set_CMOD.
+* Description: Select the clock of the TPM counter
+*
+END***************************************************************************/
+void HAL_TPM_SC_set_CMOD(TPM_Type *TPM_selected, uint8_t CMOD_value)
+{
+    /*Write the CMOD bit field*/
+    TPM_selected->SC = (TPM_selected->SC & ~(TPM_SC_CMOD_MASK)) | TPM_SC_CMOD(CMOD_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_SC_set_PS.
+* Description: Select the prescaler of the TPM counter clock
+*
+END***************************************************************************/
+void HAL_TPM_SC_set_PS(TPM_Type *TPM_selected, uint8_t PS_value)
+{
+    /*Write the PS bit field*/
+    TPM_selected->SC = (TPM_selected->SC & ~(TPM_SC_PS_MASK)) | TPM_SC_PS(PS_value);
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group SC register bit setting functions */
+
+/* ----------------------------------------------------------------------------
+   -- SC register bit reading functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_SC_read_CMOD.
+* Description: Read the clock selection of the TPM counter
+*
+END***************************************************************************/
+uint8_t HAL_TPM_SC_read_CMOD(TPM_Type *TPM_selected)
+{
+    /*Read the CMOD bit field*/
+    return (uint8_t)((TPM_selected->SC & TPM_SC_CMOD_MASK) >> TPM_SC_CMOD_SHIFT);
+}
+
+/*!
+ * @}
+ */ /* end of group SC register bit reading functions */
+
+/* ----------------------------------------------------------------------------
+   -- CNT register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_CNT_read_COUNT.
+* Description: Read the TPM counter
+*
+END***************************************************************************/
+uint16_t HAL_TPM_CNT_read_COUNT(TPM_Type *TPM_selected)
+{
+    /*Read the COUNT bit field*/
+    return (uint16_t)(TPM_selected->CNT & TPM_CNT_COUNT_MASK);
+}
+
+/*!
+ * @}
+ */ /* end of group CNT register functions */
+
+/* ----------------------------------------------------------------------------
+   -- MOD register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_MOD_set_MOD.
+* Description: Set the modulo of the TPM counter
+*
+END***************************************************************************/
+void HAL_TPM_MOD_set_MOD(TPM_Type *TPM_selected, uint16_t MOD_value)
+{
+    /*Write the MOD bit field*/
+    TPM_selected->MOD = TPM_MOD_MOD(MOD_value);
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group MOD register functions */
+
+/* ----------------------------------------------------------------------------
+   -- CnSC register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_CnSC_set_mode.
+* Description: Set the mode and edge selection of TPM channel n
+*
+END***************************************************************************/
+void HAL_TPM_CnSC_set_mode(TPM_Type *TPM_selected, uint8_t channel, uint8_t mode_value)
+{
+    /*Write the MSB, MSA, ELSB and ELSA bit fields*/
+    TPM_selected->CONTROLS[channel].CnSC = mode_value & (TPM_CnSC_MSB_MASK | TPM_CnSC_MSA_MASK |
+                                                         TPM_CnSC_ELSB_MASK | TPM_CnSC_ELSA_MASK);
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group CnSC register functions */
+
+/* ----------------------------------------------------------------------------
+   -- CnV register functions group
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_TPM_CnV_set_VAL.
+* Description: Set the match value of TPM channel n
+*
+END***************************************************************************/
+void HAL_TPM_CnV_set_VAL(TPM_Type *TPM_selected, uint8_t channel, uint16_t VAL_value)
+{
+    /*Write the VAL bit field, it is latched by the TPM at the counter overflow*/
+    TPM_selected->CONTROLS[channel].CnV = TPM_CnV_VAL(VAL_value);
+
+    return;
+}
+
+/*!
+ * @}
+ */ /* end of group CnV register functions */
+
+/*EOF*/
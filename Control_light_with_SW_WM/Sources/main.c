@@ -15,124 +15,133 @@
 #include "../Includes/Driver/Driver_SIM.h"
 #include "../Includes/Driver/Driver_GPIO.h"
 #include "../Includes/Driver/Driver_ADC0.h"
+#include "../Includes/Driver/Driver_PWM.h"
 #include "../Includes/Driver/Driver_PIT.h"
+#include "../Includes/Driver/Driver_TIMER.h"
+#include "../Includes/Driver/Driver_TASK.h"
+#include <stdlib.h>
 
 /*******************************************************************************
  * Macro
  ******************************************************************************/
 
 #define PWM_FREQUENCY_1kHZ (1000u)              /*PWM frequency at 1 kHz*/
-#define TICKS_PER_PWM_CYCLE (100u)              /*PWM will finish 1 cycle per 100 PIT interrupt*/
-#define DEFAULT_BUS_CLOCK_FREQUENCY (20971520u) /*Default bus clock frequency*/
-#define PIT_TICKS_100kHz (203u)                 /*PIT count value to get frequency at 100 kHz*/
+#define TICKS_PER_PWM_CYCLE (100u)              /*PWM duty has 100 steps per cycle*/
+#define LED_PWM_GROUP (0u)                      /*PWM group of the LEDs, it runs on PIT timer 0*/
+#define GREEN_LED_PWM_CHANNEL (0u)              /*PWM channel of the green LED*/
+#define PWM_DITHER_BITS (8u)                    /*Sub-step bits of the duty cycle*/
+#define FULL_DUTY_CYCLE (TICKS_PER_PWM_CYCLE << PWM_DITHER_BITS) /*Duty cycle value of 100%*/
+
+#define SOFTWARE_TIMER_PIT (1u)                 /*PIT timer of the software timers, PIT0 belongs to the LED PWM group*/
+#define TIMER_TICK_FREQUENCY (1000u)            /*Software timer tick of 1 ms*/
+#define SAMPLE_PERIOD_MS (10u)                  /*Time between two light samples*/
+#define TELEMETRY_MIN_INTERVAL_MS (500u)        /*Shortest time between two telemetry snapshots*/
+#define HOUSEKEEPING_PERIOD_MS (1000u)          /*Time between two housekeeping runs*/
+
+#define CONTROL_TASK (0u)                       /*Priority of the task mapping the light to the duty cycle*/
+#define SAMPLING_TASK (1u)                      /*Priority of the task reading the light sensor*/
+#define TELEMETRY_TASK (2u)                     /*Priority of the task taking the telemetry snapshot*/
+#define HOUSEKEEPING_TASK (3u)                  /*Priority of the task keeping the uptime*/
+
+#define EVENT_TICK (1u << 0u)                   /*The period of a periodic task elapsed*/
+#define EVENT_NEW_SAMPLE (1u << 1u)             /*A new light value is stored*/
+#define EVENT_DUTY_CHANGED (1u << 2u)           /*The duty cycle of the green LED changed*/
+#define EVENT_UPTIME (1u << 3u)                 /*The uptime changed*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Snapshot of the application state, read with the debugger
+ */
+typedef struct telemetry
+{
+    uint32_t light_value;       /*Last digital value of the light intensity*/
+    uint32_t duty_cycle;        /*Duty cycle of the green LED*/
+    uint32_t sample_count;      /*Number of light samples taken*/
+    uint32_t duty_changes;      /*Number of duty cycle changes*/
+    uint32_t uptime_seconds;    /*Seconds since the tasks started*/
+} telemetry_info;
 
 /*******************************************************************************
  * Variable
  ******************************************************************************/
 
-static volatile uint32_t ticks = 0; /*ticks is the number of PIT interrupt has occured*/
-static uint8_t signal_state = 0;    /*sinal_state is the logic level of the PWM pulse*/
+static uint32_t sampled_light_value = 0;    /*Digital value of the light intensity of the last sample*/
+static uint32_t LED_duty_cycle = 0;         /*Duty cycle written to the green LED*/
+static uint32_t sample_count = 0;           /*Number of light samples taken*/
+static uint32_t duty_changes = 0;           /*Number of duty cycle changes*/
+static uint32_t uptime_seconds = 0;         /*Seconds since the tasks started*/
+
+static volatile telemetry_info telemetry = {0, 0, 0, 0, 0}; /*Last telemetry snapshot*/
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 
 /**
- * @brief Create a PWM based on the PIT ticks interrupt
+ * @brief Convert the light intensity to digital value
  *
- * @param duty_cycle is the time which the PWM pulse is on high logic level
+ * @param ADC0_config is a struct pointer that has the information about the ADC0 configuration
  *
- * @return: this function return nothing.
+ * @return the digital value of the light intensity
  */
-void software_PWM(uint32_t duty_cycle);
+uint32_t get_light_value(ADC0_config_info *ADC0_config);
 
 /**
- * @brief Update ticks value after each PIT interrupt event
+ * @brief Get duty cycle based on the light intensity
  *
- * @param: This function has no parameter.
+ * @param light_value is the digital value of the light intensity
+ *
+ * @return the duty cycle (0 to FULL_DUTY_CYCLE)
+ */
+uint32_t get_duty_cycle(uint32_t light_value);
+
+/**
+ * @brief Task reading the light sensor, it runs every SAMPLE_PERIOD_MS
+ *
+ * @param context is the ADC0 configuration
+ * @param events is the events posted to the task
  *
  * @return: this function return nothing.
  */
-void Update_ticks_PIT_IRQ(void);
+void sampling_task(void *context, uint32_t events);
 
 /**
- * @brief Convert the light intensity to digital value
+ * @brief Task mapping a new light sample to the duty cycle of the green LED
  *
- * @param ADC0_config is a struct pointer that has the information about the ADC0 configuration
+ * @param context is not used
+ * @param events is the events posted to the task
  *
- * @return the digital value of the light intensity
+ * @return: this function return nothing.
  */
-uint32_t get_light_value(ADC0_config_info *ADC0_config);
+void control_task(void *context, uint32_t events);
 
 /**
- * @brief Get duty cycle based on the light intensity
+ * @brief Task taking the telemetry snapshot, at most once per TELEMETRY_MIN_INTERVAL_MS
  *
- * @param light_value is the digital value of the light intensity
+ * @param context is not used
+ * @param events is the events posted to the task
  *
- * @return the duty cycle
+ * @return: this function return nothing.
  */
-uint8_t get_duty_cycle(uint32_t light_value);
+void telemetry_task(void *context, uint32_t events);
 
 /**
- * @brief Control the LED corresponding to the PWM pulse
+ * @brief Task keeping the uptime, it runs every HOUSEKEEPING_PERIOD_MS
  *
- * @param green_LED is a struct pointer that has information about green LED configuration
+ * @param context is not used
+ * @param events is the events posted to the task
  *
  * @return: this function return nothing.
  */
-void control_green_LED(GPIO_config_info_t *green_LED);
+void housekeeping_task(void *context, uint32_t events);
 
 /*******************************************************************************
  * Functions
  ******************************************************************************/
 
-/*Functions*********************************************************************
-*
-* Function name: software_PWM
-* Description: Create a PWM based on the PIT ticks interrupt
-*
-END***************************************************************************/
-void software_PWM(uint32_t duty_cycle)
-{
-    /*If the ticks is smaller than or equal to duty cycle*/
-    if (ticks <= duty_cycle)
-    {
-        /*Set PWM pulse at high logic level*/
-        signal_state = 1;
-    }
-    /*If the ticks is greater than duty cycle*/
-    else
-    {
-        /*Set PWM pulse at low logic level*/
-        signal_state = 0;
-    }
-
-    return;
-}
-
-/*Functions*********************************************************************
-*
-* Function name: Update_ticks_PIT_IRQ
-* Description: Update the ticks after each interrupt event.
-*
-END***************************************************************************/
-void Update_ticks_PIT_IRQ(void)
-{
-    /*If the ticks is greater than or equal to the PWM ticks limit per cycle*/
-    if (ticks >= TICKS_PER_PWM_CYCLE)
-    {
-        /*Reset ticks value*/
-        ticks = 0;
-    }
-    else
-    {
-        /*Increase ticks by 1*/
-        ticks++;
-    }
-
-    return;
-}
-
 /*Functions*********************************************************************
 *
 * Function name: get_light_value
@@ -161,27 +170,27 @@ uint32_t get_light_value(ADC0_config_info *ADC0_config)
 * Description: Get duty cycle based on the light digital value
 *
 END***************************************************************************/
-uint8_t get_duty_cycle(uint32_t light_value)
+uint32_t get_duty_cycle(uint32_t light_value)
 {
-    uint8_t ret_value = 0;  /*This variable stores the return value of the function*/
+    uint32_t ret_value = 0; /*This variable stores the return value of the function*/
 
     /*If the light intensity is too high*/
-    if (light_value <= 0xC8u)
+    if (light_value <= 0xC800u)
     {
         /*Set duty cycle to 0*/
         ret_value = 0;
     }
     /*If the light intensity is in middle range*/
-    else if (light_value <= 0xF0)
+    else if (light_value <= 0xF000u)
     {
-        /*Get the duty cycle*/
-        ret_value = ((light_value - 0xC0u) * 100)/(0xF0 - 0xC0u);
+        /*Get the duty cycle with its sub-step bits, the PWM dithers them*/
+        ret_value = ((light_value - 0xC000u) * FULL_DUTY_CYCLE) / (0xF000u - 0xC000u);
     }
     /*If the light intensity is too low*/
     else
     {
         /*Set duty cycle to be the total ticks per cycle*/
-        ret_value = 100;
+        ret_value = FULL_DUTY_CYCLE;
     }
 
     return ret_value;
@@ -189,27 +198,91 @@ uint8_t get_duty_cycle(uint32_t light_value)
 
 /*Functions*********************************************************************
 *
-* Function name: control_green_LED
-* Description: Turn on or turn off the LED based on the PWM
+* Function name: sampling_task
+* Description: Read the light sensor and hand the value to the control task
+*
+END***************************************************************************/
+void sampling_task(void *context, uint32_t events)
+{
+    (void)events;
+
+    /*Get digital value of light intensity*/
+    sampled_light_value = get_light_value((ADC0_config_info *)context);
+    sample_count++;
+    Driver_TASK_post(CONTROL_TASK, EVENT_NEW_SAMPLE);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: control_task
+* Description: The duty cycle is only written when it changes
 *
 END***************************************************************************/
-void control_green_LED(GPIO_config_info_t *green_LED)
+void control_task(void *context, uint32_t events)
 {
-    /*If the PWM is on duty cycle*/
-    if (1 == signal_state)
+    uint32_t new_duty_cycle = 0;    /*Duty cycle of the last sample*/
+
+    (void)context;
+    (void)events;
+
+    /*Get duty cycle based on the light intensity*/
+    new_duty_cycle = get_duty_cycle(sampled_light_value);
+    if (new_duty_cycle != LED_duty_cycle)
     {
-        /*Turn on green LED*/
-        Driver_GPIO_set_pin_State(green_LED->port_type, green_LED->pin, LOW_STATE);
+        LED_duty_cycle = new_duty_cycle;
+        /*Publish the duty cycle, the PWM drives the green LED*/
+        Driver_PWM_set_duty(LED_PWM_GROUP, GREEN_LED_PWM_CHANNEL, LED_duty_cycle);
+        duty_changes++;
+        Driver_TASK_post(TELEMETRY_TASK, EVENT_DUTY_CHANGED);
     }
     else
     {
-        /*Turn off the green LED*/
-        Driver_GPIO_set_pin_State(green_LED->port_type, green_LED->pin, HIGH_STATE);
+        /*Do nothing*/
     }
 
     return;
 }
 
+/*Functions*********************************************************************
+*
+* Function name: telemetry_task
+* Description: Copy the application state to the snapshot, the changes
+*              posted during the rate limit are taken in one run
+*
+END***************************************************************************/
+void telemetry_task(void *context, uint32_t events)
+{
+    (void)context;
+    (void)events;
+
+    telemetry.light_value = sampled_light_value;
+    telemetry.duty_cycle = LED_duty_cycle;
+    telemetry.sample_count = sample_count;
+    telemetry.duty_changes = duty_changes;
+    telemetry.uptime_seconds = uptime_seconds;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: housekeeping_task
+* Description: Count the uptime
+*
+END***************************************************************************/
+void housekeeping_task(void *context, uint32_t events)
+{
+    (void)context;
+    (void)events;
+
+    uptime_seconds++;
+    Driver_TASK_post(TELEMETRY_TASK, EVENT_UPTIME);
+
+    return;
+}
+
 /*Functions*********************************************************************
 *
 * Function name: main
@@ -218,8 +291,11 @@ void control_green_LED(GPIO_config_info_t *green_LED)
 END***************************************************************************/
 int main(void)
 {
-    uint32_t light_value = 0;   /*This variable stores the digital value of light intensity*/
-    uint32_t duty_cycle = 0;    /*This variable stores the duty cycle of the PWM*/
+    uint32_t PWM_frequency = 0; /*This variable stores the PWM frequency obtained from the bus clock*/
+    uint8_t index = 0;          /*Index of the task to create*/
+
+    /*Load value of the software timer tick*/
+    PIT_rate_info tick_rate = {0, 0, 0, 0, 0, 0};
 
     /*SCGC5 configuration info*/
     SCGC5_config_info SCGC5_config = {
@@ -241,7 +317,7 @@ int main(void)
         /*CFG1 register configuration*/
         .CFG1_config.clock_source = BUS_CLOCK,
         .CFG1_config.clock_divide = DIV_1,
-        .CFG1_config.conversion_mode = SINGLE_END_8BITS,
+        .CFG1_config.conversion_mode = SINGLE_END_16BITS,
         .CFG1_config.sample_time = SHORT_SAMPLE_TIME,
         /*SC1n register configuration*/
         .SC1_config.DIFF_mode = SINGLE_ENDED_INPUT,
@@ -259,18 +335,60 @@ int main(void)
         .initial_state = HIGH_STATE,
     };
 
-    /*PIT configuration info*/
-    PIT_config_info PIT_config = {
-        /*MCR resigter configuration*/
-        .MCR_config.freeze_mode = TIMERS_STOPPED_IN_DEBUG,
-        .MCR_config.module_state = PIT_ENABLED,
-        /*TCTRLn register configuration*/
-        .TCTRLn_config.timer_index = 0,
-        .TCTRLn_config.timer_state = TIMER_ENABLED,
-        .TCTRLn_config.chain_mode = CHAIN_MODE_DISABLED,
-        .TCTRLn_config.IRQ_state = IRQ_ENABLED,
-        /*Load value for PIT timer*/
-        .load_value = PIT_TICKS_100kHz,
+    /*PWM channel of the green LED, it is on at low logic level, PTD5 has TPM0_CH5 so it runs on the TPM*/
+    PWM_channel_config_info PWM_channels[] = {
+        {
+            .port_type = PORT_D,
+            .pin = 5,
+            .active_state = LOW_STATE,
+        },
+    };
+
+    /*PWM configuration info, the mode, output stage and phase settings only apply to channels on the PIT*/
+    PWM_config_info PWM_config = {
+        .mode = PWM_EDGE_MODE,
+        .timer_index = LED_PWM_GROUP,
+        .dither_bits = PWM_DITHER_BITS,
+        /*The PIT interrupt writes the pins*/
+        .output_stage = PWM_OUTPUT_ISR,
+        /*Channels added later do not switch on together*/
+        .phase_mode = PWM_PHASE_SPREAD,
+        .channel_count = sizeof(PWM_channels) / sizeof(PWM_channels[0]),
+        .channels = PWM_channels,
+    };
+
+    /*Software timer configuration info*/
+    TIMER_config_info TIMER_config = {
+        .timer_index = SOFTWARE_TIMER_PIT,
+        .tick_counts = 0,
+    };
+
+    /*Task configuration info, the events of a task are handled in priority order*/
+    TASK_config_info task_configs[] = {
+        {
+            .priority = CONTROL_TASK,
+            .task_func = control_task,
+            .context = NULL,
+            .min_interval_ticks = 0,
+        },
+        {
+            .priority = SAMPLING_TASK,
+            .task_func = sampling_task,
+            .context = &ADC0_config,
+            .min_interval_ticks = 0,
+        },
+        {
+            .priority = TELEMETRY_TASK,
+            .task_func = telemetry_task,
+            .context = NULL,
+            .min_interval_ticks = TELEMETRY_MIN_INTERVAL_MS,
+        },
+        {
+            .priority = HOUSEKEEPING_TASK,
+            .task_func = housekeeping_task,
+            .context = NULL,
+            .min_interval_ticks = 0,
+        },
     };
 
     /*Init clock according to SCGC5 configuration*/
@@ -281,22 +399,39 @@ int main(void)
     Driver_ADC0_init_ADC(&ADC0_config);
     /*Init GPIO pin according to green LED configuration*/
     Driver_GPIO_init_pin(&green_LED);
-    /*Init PIT according to PIT configuration*/
-    Driver_PIT_init(&PIT_config);
-    /*Register update ticks callback function for PIT interrupt handler*/
-    Driver_PIT_register_callabck(Update_ticks_PIT_IRQ);
+    /*Get the PWM period from the bus clock, then init the PWM*/
+    if (PWM_STATUS_OK ==
+        Driver_PWM_config_frequency(&PWM_config, PWM_FREQUENCY_1kHZ, TICKS_PER_PWM_CYCLE, &PWM_frequency))
+    {
+        /*The TPM drives the green LED, the PIT only runs the channels without a TPM channel*/
+        Driver_PWM_init(&PWM_config);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
 
-    while (1)
+    /*The software timers tick every millisecond on PIT1*/
+    if (1 == Driver_PIT_calculate_rate(TIMER_TICK_FREQUENCY, Driver_SIM_get_bus_clock(), &tick_rate))
     {
-        /*Get digital value of light intensity*/
-        light_value = get_light_value(&ADC0_config);
-        /*Get duty cycle based on the light intensity*/
-        duty_cycle = get_duty_cycle(light_value);
-        /*Run the software PWM*/
-        software_PWM(duty_cycle);
-        /*Control the green LED by the software PWM*/
-        control_green_LED(&green_LED);
+        TIMER_config.tick_counts = tick_rate.load_value + 1u;
+        Driver_TIMER_init(&TIMER_config);
     }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    /*Create the tasks, then start the periodic ones*/
+    for (index = 0; index < (sizeof(task_configs) / sizeof(task_configs[0])); index++)
+    {
+        Driver_TASK_create(&task_configs[index]);
+    }
+    Driver_TASK_start_periodic(SAMPLING_TASK, EVENT_TICK, SAMPLE_PERIOD_MS);
+    Driver_TASK_start_periodic(HOUSEKEEPING_TASK, EVENT_TICK, HOUSEKEEPING_PERIOD_MS);
+
+    /*Run the tasks when they have events, the core sleeps in between*/
+    Driver_TASK_run();
 
     return 0;
 }
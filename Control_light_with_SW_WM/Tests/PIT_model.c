@@ -0,0 +1,1029 @@
+/**
+ * @file  : PIT_model.c
+ * @author: Nguyen The Anh.
+ * @brief : Host model of the PIT registers, and the drivers the PWM engine calls.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/HAL/HAL_PIT.h"
+#include "../Includes/HAL/HAL_CORE.h"
+#include "../Includes/Driver/Driver_TPM.h"
+#include "../Includes/Driver/Driver_PORT.h"
+#include "../Includes/Driver/Driver_DMAMUX.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define PIT_MODEL_TIMER_COUNT (2u)          /*PIT timers of the MKL46Z4*/
+#define PIT_MODEL_NO_TIMEOUT (0xFFFFFFFFFFFFFFFFull)   /*Timeout of a timer which does not run*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Registers and counter of one PIT timer
+ */
+typedef struct PIT_model_timer
+{
+    uint32_t load_value;    /*LDVAL*/
+    uint8_t enabled;        /*TCTRL.TEN*/
+    uint8_t IRQ_enabled;    /*TCTRL.TIE*/
+    uint8_t chained;        /*TCTRL.CHN, timer 1 counts the timeouts of timer 0*/
+    uint8_t flag;           /*TFLG.TIF*/
+    uint64_t start;         /*Time the running interval started*/
+    uint64_t length;        /*Counts of the running interval, LDVAL + 1 at its start*/
+    uint32_t chained_value; /*CVAL of a chained timer*/
+} PIT_model_timer_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+uint64_t PIT_model_time = 0;
+uint32_t PIT_model_interrupts = 0;
+uint32_t PIT_model_accesses = 0;
+uint32_t PIT_model_port_output[PIT_MODEL_PORT_COUNT];
+PIT_model_pin_hook PIT_model_hook = NULL;
+uint32_t PIT_model_failures = 0;
+PIT_model_DMA_info PIT_model_DMA[DMA_CHANNEL_COUNT];
+uint64_t PIT_model_sleep_end = 0;
+jmp_buf PIT_model_sleep_exit;
+uint32_t PIT_model_sleeps = 0;
+
+static PIT_model_timer_info PIT_model_timers[PIT_MODEL_TIMER_COUNT];   /*State of each timer*/
+static uint8_t PIT_model_module_disabled = 0;   /*MCR.MDIS*/
+static uint8_t PIT_model_IRQ_handler_enabled = 0;   /*PIT interrupt enabled in the NVIC*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Interrupt handler of the PIT module, defined in Driver_PIT.c
+ *
+ * @return: this function return nothing.
+ */
+void PIT_IRQHandler(void);
+
+/**
+ * @brief Count timer 1 down by one timeout of timer 0 while it is chained
+ *
+ * @return: this function return nothing.
+ */
+static void PIT_model_chain_timeout(void);
+
+/**
+ * @brief Reload the timers whose interval ended by the current time and set their flags
+ *
+ * @return: this function return nothing.
+ */
+static void PIT_model_update(void);
+
+/**
+ * @brief Find the next timeout of a timer counting the bus clock
+ *
+ * @return the time of the next timeout, PIT_MODEL_NO_TIMEOUT if no timer runs.
+ */
+static uint64_t PIT_model_next_timeout(void);
+
+/**
+ * @brief Go to the next timeout before a time and take the interrupt
+ *
+ * @param end_time is the time not to go past
+ *
+ * @return 1 if a timeout was reached, 0 if there is none before the end time.
+ */
+static uint8_t PIT_model_step(uint64_t end_time);
+
+/**
+ * @brief Write new levels to the pins of a port and call the hook for the pins which changed
+ *
+ * @param port_type is the port written
+ * @param levels is the new output level of every pin of the port
+ *
+ * @return: this function return nothing.
+ */
+static void PIT_model_write_port(Port_type_enum_t port_type, uint32_t levels);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_chain_timeout
+* Description: A chained timer times out on the trigger after it reads 0
+*
+END***************************************************************************/
+static void PIT_model_chain_timeout(void)
+{
+    PIT_model_timer_info *timer = &PIT_model_timers[1];    /*Chained timer*/
+
+    if ((1 == timer->enabled) && (1 == timer->chained))
+    {
+        if (0 == timer->chained_value)
+        {
+            timer->flag = 1;
+            timer->chained_value = timer->load_value;
+        }
+        else
+        {
+            timer->chained_value--;
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_update
+* Description: The counter reloads at the exact timeout, even when the
+*              interrupt of the previous one is late
+*
+END***************************************************************************/
+static void PIT_model_update(void)
+{
+    uint8_t timer_index = 0;        /*Index of the timer*/
+    PIT_model_timer_info *timer = NULL; /*Timer updated*/
+
+    for (timer_index = 0; timer_index < PIT_MODEL_TIMER_COUNT; timer_index++)
+    {
+        timer = &PIT_model_timers[timer_index];
+
+        while ((0 == PIT_model_module_disabled) && (1 == timer->enabled) && (0 == timer->chained) &&
+               ((timer->start + timer->length) <= PIT_model_time))
+        {
+            timer->start += timer->length;
+            timer->length = (uint64_t)timer->load_value + 1u;
+            timer->flag = 1;
+
+            if (0 == timer_index)
+            {
+                PIT_model_chain_timeout();
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_next_timeout
+* Description: Find the next timeout of a timer counting the bus clock
+*
+END***************************************************************************/
+static uint64_t PIT_model_next_timeout(void)
+{
+    uint8_t timer_index = 0;        /*Index of the timer*/
+    PIT_model_timer_info *timer = NULL; /*Timer looked at*/
+    uint64_t ret_val = PIT_MODEL_NO_TIMEOUT;    /*This variable stores the return value of the function*/
+
+    for (timer_index = 0; timer_index < PIT_MODEL_TIMER_COUNT; timer_index++)
+    {
+        timer = &PIT_model_timers[timer_index];
+
+        if ((0 == PIT_model_module_disabled) && (1 == timer->enabled) && (0 == timer->chained) &&
+            ((timer->start + timer->length) < ret_val))
+        {
+            ret_val = timer->start + timer->length;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_step
+* Description: An interrupt which ran past the next timeout makes the next
+*              one late, the time never goes back
+*
+END***************************************************************************/
+static uint8_t PIT_model_step(uint64_t end_time)
+{
+    uint64_t timeout = PIT_model_next_timeout();    /*Time of the next timeout*/
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    if ((PIT_MODEL_NO_TIMEOUT != timeout) && (timeout <= end_time))
+    {
+        if (timeout > PIT_model_time)
+        {
+            PIT_model_time = timeout;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        PIT_model_update();
+
+        if ((1 == PIT_model_IRQ_handler_enabled) &&
+            (((1 == PIT_model_timers[0].flag) && (1 == PIT_model_timers[0].IRQ_enabled)) ||
+             ((1 == PIT_model_timers[1].flag) && (1 == PIT_model_timers[1].IRQ_enabled))))
+        {
+            PIT_model_interrupts++;
+            PIT_IRQHandler();
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_reset
+* Description: Stop both timers, clear the pins and the counters
+*
+END***************************************************************************/
+void PIT_model_reset(void)
+{
+    memset(PIT_model_timers, 0, sizeof(PIT_model_timers));
+    memset(PIT_model_port_output, 0, sizeof(PIT_model_port_output));
+    memset(PIT_model_DMA, 0, sizeof(PIT_model_DMA));
+    PIT_model_time = 0;
+    PIT_model_interrupts = 0;
+    PIT_model_accesses = 0;
+    PIT_model_hook = NULL;
+    PIT_model_module_disabled = 0;
+    PIT_model_IRQ_handler_enabled = 0;
+    PIT_model_sleep_end = 0;
+    PIT_model_sleeps = 0;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_run_until
+* Description: Take every timeout up to the end time
+*
+END***************************************************************************/
+void PIT_model_run_until(uint64_t end_time)
+{
+    while (1 == PIT_model_step(end_time))
+    {
+    }
+
+    if (end_time > PIT_model_time)
+    {
+        PIT_model_time = end_time;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    PIT_model_update();
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_run_interrupts
+* Description: Take timeouts until the interrupt count is reached
+*
+END***************************************************************************/
+void PIT_model_run_interrupts(uint32_t interrupts)
+{
+    uint32_t target = PIT_model_interrupts + interrupts;   /*Interrupt count to stop at*/
+
+    while ((PIT_model_interrupts != target) && (1 == PIT_model_step(PIT_MODEL_NO_TIMEOUT)))
+    {
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_read_pin
+* Description: Read the output level of a pin
+*
+END***************************************************************************/
+uint8_t PIT_model_read_pin(Port_type_enum_t port_type, uint8_t pin)
+{
+    return (uint8_t)((PIT_model_port_output[port_type] >> pin) & 1u);
+}
+
+/* ----------------------------------------------------------------------------
+   -- PIT HAL, the model of the registers
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_MCR_set_MDIS
+* Description: A disabled module stops both counters
+*
+END***************************************************************************/
+void HAL_PIT_MCR_set_MDIS(uint8_t MDIS_value)
+{
+    PIT_model_update();
+    PIT_model_module_disabled = MDIS_value;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_MCR_set_FRZ
+* Description: The model has no debug mode
+*
+END***************************************************************************/
+void HAL_PIT_MCR_set_FRZ(uint8_t FRZ_value)
+{
+    (void)FRZ_value;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_LDVALn_set_TSV
+* Description: The running interval keeps its length, the value is loaded
+*              at the next timeout
+*
+END***************************************************************************/
+void HAL_PIT_LDVALn_set_TSV(uint8_t timer_index, uint32_t TSV_value)
+{
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        PIT_model_timers[timer_index].load_value = TSV_value;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_CVALn_read_TVL
+* Description: A read lasts one bus clock count
+*
+END***************************************************************************/
+uint32_t HAL_PIT_CVALn_read_TVL(uint8_t timer_index)
+{
+    PIT_model_timer_info *timer = NULL; /*Timer read*/
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        timer = &PIT_model_timers[timer_index];
+
+        if (1 == timer->chained)
+        {
+            ret_val = timer->chained_value;
+        }
+        else
+        {
+            ret_val = (uint32_t)((timer->start + timer->length - 1u) - PIT_model_time);
+        }
+
+        PIT_model_time++;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_TCTRLn_set_CHN
+* Description: Select whether timer n counts the timeouts of timer n - 1
+*
+END***************************************************************************/
+void HAL_PIT_TCTRLn_set_CHN(uint8_t timer_index, uint8_t CHN_value)
+{
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        PIT_model_timers[timer_index].chained = CHN_value;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_TCTRLn_set_TIE
+* Description: Enable or disable the interrupt of timer n
+*
+END***************************************************************************/
+void HAL_PIT_TCTRLn_set_TIE(uint8_t timer_index, uint8_t TIE_value)
+{
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_timers[timer_index].IRQ_enabled = TIE_value;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_TCTRLn_set_TEN
+* Description: A timer which starts loads LDVAL
+*
+END***************************************************************************/
+void HAL_PIT_TCTRLn_set_TEN(uint8_t timer_index, uint8_t TEN_value)
+{
+    PIT_model_timer_info *timer = NULL; /*Timer started or stopped*/
+
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        timer = &PIT_model_timers[timer_index];
+
+        if ((0 == timer->enabled) && (1 == TEN_value))
+        {
+            timer->start = PIT_model_time;
+            timer->length = (uint64_t)timer->load_value + 1u;
+            timer->chained_value = timer->load_value;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        timer->enabled = TEN_value;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_TFLGn_read_TIF
+* Description: Read timer interrupt flag
+*
+END***************************************************************************/
+uint8_t HAL_PIT_TFLGn_read_TIF(uint8_t timer_index)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        ret_val = PIT_model_timers[timer_index].flag;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_TFLGn_set_TIF
+* Description: Writing 1 clears the flag
+*
+END***************************************************************************/
+void HAL_PIT_TFLGn_set_TIF(uint8_t timer_index)
+{
+    if (timer_index < PIT_MODEL_TIMER_COUNT)
+    {
+        PIT_model_accesses++;
+        PIT_model_update();
+        PIT_model_timers[timer_index].flag = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_LTMR64_read_LT
+* Description: Timer 1 is the upper half and timer 0 the lower half
+*
+END***************************************************************************/
+uint64_t HAL_PIT_LTMR64_read_LT(void)
+{
+    uint64_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    /*LTMR64H is read first*/
+    ret_val = (uint64_t)HAL_PIT_CVALn_read_TVL(1) << 32u;
+    ret_val |= HAL_PIT_CVALn_read_TVL(0);
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_enable_IRQ_Handler
+* Description: Enable the PIT interrupt in the NVIC
+*
+END***************************************************************************/
+void HAL_PIT_enable_IRQ_Handler(void)
+{
+    PIT_model_IRQ_handler_enabled = 1;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_PIT_disable_IRQ_Handler
+* Description: Mask the PIT interrupt in the NVIC, a set flag stays pending
+*
+END***************************************************************************/
+void HAL_PIT_disable_IRQ_Handler(void)
+{
+    PIT_model_IRQ_handler_enabled = 0;
+
+    return;
+}
+
+/* ----------------------------------------------------------------------------
+   -- Core, the model only takes an interrupt while a test runs the time or while the core sleeps
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_PRIMASK_disable_IRQ
+* Description: Nothing to mask, the caller runs to its end
+*
+END***************************************************************************/
+uint32_t HAL_CORE_PRIMASK_disable_IRQ(void)
+{
+    return 0;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_PRIMASK_restore
+* Description: Nothing to restore
+*
+END***************************************************************************/
+void HAL_CORE_PRIMASK_restore(uint32_t primask)
+{
+    (void)primask;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: HAL_CORE_wait_for_IRQ
+* Description: Sleep until the next timeout and take its interrupt. With no
+*              timeout before PIT_model_sleep_end the core would sleep for
+*              ever, the test takes back control at PIT_model_sleep_exit.
+*
+END***************************************************************************/
+void HAL_CORE_wait_for_IRQ(void)
+{
+    PIT_model_sleeps++;
+
+    if (0 == PIT_model_step(PIT_model_sleep_end))
+    {
+        PIT_model_run_until(PIT_model_sleep_end);
+        longjmp(PIT_model_sleep_exit, 1);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/* ----------------------------------------------------------------------------
+   -- GPIO driver, the pins are kept in PIT_model_port_output
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: PIT_model_write_port
+* Description: Write the levels of a port and report the pins which changed
+*
+END***************************************************************************/
+static void PIT_model_write_port(Port_type_enum_t port_type, uint32_t levels)
+{
+    uint32_t changed_pins = PIT_model_port_output[port_type] ^ levels;  /*Pins whose level changes*/
+
+    PIT_model_accesses++;
+    PIT_model_port_output[port_type] = levels;
+
+    if ((0 != changed_pins) && (NULL != PIT_model_hook))
+    {
+        PIT_model_hook(port_type, changed_pins);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_set_pin_State
+* Description: Set the level of one pin
+*
+END***************************************************************************/
+void Driver_GPIO_set_pin_State(Port_type_enum_t port_type, uint8_t pin, Pin_state_enum_t state)
+{
+    if (HIGH_STATE == state)
+    {
+        PIT_model_write_port(port_type, PIT_model_port_output[port_type] | (1u << pin));
+    }
+    else
+    {
+        PIT_model_write_port(port_type, PIT_model_port_output[port_type] & ~(1u << pin));
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_set_port_pins
+* Description: Set the pins of a mask (PSOR)
+*
+END***************************************************************************/
+void Driver_GPIO_set_port_pins(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    PIT_model_write_port(port_type, PIT_model_port_output[port_type] | pin_mask);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_clear_port_pins
+* Description: Clear the pins of a mask (PCOR)
+*
+END***************************************************************************/
+void Driver_GPIO_clear_port_pins(Port_type_enum_t port_type, uint32_t pin_mask)
+{
+    PIT_model_write_port(port_type, PIT_model_port_output[port_type] & ~pin_mask);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_get_set_register_address
+* Description: The model has no DMA, the address is never written
+*
+END***************************************************************************/
+uint32_t Driver_GPIO_get_set_register_address(Port_type_enum_t port_type)
+{
+    return 0x400FF004u + (0x40u * (uint32_t)port_type);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_GPIO_get_clear_register_address
+* Description: The model has no DMA, the address is never written
+*
+END***************************************************************************/
+uint32_t Driver_GPIO_get_clear_register_address(Port_type_enum_t port_type)
+{
+    return 0x400FF008u + (0x40u * (uint32_t)port_type);
+}
+
+/* ----------------------------------------------------------------------------
+   -- SIM, PORT, TPM and DMA drivers, no pin has a TPM channel and the DMA moves no data
+   ---------------------------------------------------------------------------- */
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_get_bus_clock
+* Description: Bus clock of the board
+*
+END***************************************************************************/
+uint32_t Driver_SIM_get_bus_clock(void)
+{
+    return PIT_MODEL_BUS_CLOCK;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_SIM_get_TPM_clock
+* Description: MCGFLLCLK of the board
+*
+END***************************************************************************/
+uint32_t Driver_SIM_get_TPM_clock(void)
+{
+    return 2u * PIT_MODEL_BUS_CLOCK;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_PORT_set_MUX_pin
+* Description: The model has no pin mux
+*
+END***************************************************************************/
+void Driver_PORT_set_MUX_pin(Port_type_enum_t port_type, uint8_t pin, Mux_type_enum_t mux_type)
+{
+    (void)port_type;
+    (void)pin;
+    (void)mux_type;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_find_pin_route
+* Description: No pin has a TPM channel, every channel uses the PIT engine
+*
+END***************************************************************************/
+uint8_t Driver_TPM_find_pin_route(Port_type_enum_t port_type, uint8_t pin, TPM_pin_route_info *route)
+{
+    (void)port_type;
+    (void)pin;
+    (void)route;
+
+    return 0;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_init
+* Description: Never called, no pin has a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_init(TPM_config_info *TPM_config)
+{
+    (void)TPM_config;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_stop
+* Description: Never called, no pin has a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_stop(uint8_t TPM_index)
+{
+    (void)TPM_index;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_config_channel
+* Description: Never called, no pin has a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_config_channel(uint8_t TPM_index, uint8_t channel, TPM_channel_mode_enum_t mode)
+{
+    (void)TPM_index;
+    (void)channel;
+    (void)mode;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_set_channel_value
+* Description: Never called, no pin has a TPM channel
+*
+END***************************************************************************/
+void Driver_TPM_set_channel_value(uint8_t TPM_index, uint8_t channel, uint16_t value)
+{
+    (void)TPM_index;
+    (void)channel;
+    (void)value;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_TPM_read_counter
+* Description: Never called, no pin has a TPM channel
+*
+END***************************************************************************/
+uint16_t Driver_TPM_read_counter(uint8_t TPM_index)
+{
+    (void)TPM_index;
+
+    return 0;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_register_callback
+* Description: Keep the callback, the test calls it as the DMA interrupt
+*
+END***************************************************************************/
+void Driver_DMA_register_callback(uint8_t channel, DMA_callback callback_func)
+{
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        PIT_model_DMA[channel].callback = callback_func;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_init
+* Description: Like the driver, a byte count over the 20-bit field is
+*              rejected and leaves the channel unchanged
+*
+END***************************************************************************/
+uint8_t Driver_DMA_init(DMA_config_info *DMA_config)
+{
+    uint8_t ret_val = 0;    /*This variable stores the return value of the function*/
+
+    if ((NULL != DMA_config) && (DMA_config->channel < DMA_CHANNEL_COUNT) &&
+        (DMA_config->linked_channel < DMA_CHANNEL_COUNT) && (DMA_config->byte_count <= DMA_MAX_BYTE_COUNT))
+    {
+        PIT_model_DMA[DMA_config->channel].configured = 1;
+        PIT_model_DMA[DMA_config->channel].byte_count = DMA_config->byte_count;
+        PIT_model_DMA[DMA_config->channel].source_address = DMA_config->source_address;
+        PIT_model_DMA[DMA_config->channel].link = DMA_config->link;
+        PIT_model_DMA[DMA_config->channel].linked_channel = DMA_config->linked_channel;
+        ret_val = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_stop
+* Description: The channel takes no more request
+*
+END***************************************************************************/
+void Driver_DMA_stop(uint8_t channel)
+{
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        PIT_model_DMA[channel].configured = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_set_byte_count
+* Description: Like the driver, a byte count over the 20-bit field is
+*              ignored
+*
+END***************************************************************************/
+void Driver_DMA_set_byte_count(uint8_t channel, uint32_t byte_count)
+{
+    if ((channel < DMA_CHANNEL_COUNT) && (byte_count <= DMA_MAX_BYTE_COUNT))
+    {
+        PIT_model_DMA[channel].byte_count = byte_count;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMA_read_source_address
+* Description: The model moves no data, the source stays at its start
+*
+END***************************************************************************/
+uint32_t Driver_DMA_read_source_address(uint8_t channel)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        ret_val = PIT_model_DMA[channel].source_address;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMAMUX_init
+* Description: Route the PIT trigger to a DMA channel
+*
+END***************************************************************************/
+void Driver_DMAMUX_init(DMAMUX_config_info *DMAMUX_config)
+{
+    if ((NULL != DMAMUX_config) && (DMAMUX_config->channel < DMA_CHANNEL_COUNT))
+    {
+        PIT_model_DMA[DMAMUX_config->channel].triggered = 1;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: Driver_DMAMUX_disable
+* Description: Remove the trigger of a DMA channel
+*
+END***************************************************************************/
+void Driver_DMAMUX_disable(uint8_t channel)
+{
+    if (channel < DMA_CHANNEL_COUNT)
+    {
+        PIT_model_DMA[channel].triggered = 0;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+/*EOF*/
@@ -0,0 +1,153 @@
+/**
+ * @file  : PIT_model.h
+ * @author: Nguyen The Anh.
+ * @brief : Declare the host model of the PIT and the drivers the PWM engine calls.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <setjmp.h>
+#include "../Includes/Driver/Driver_PIT.h"
+#include "../Includes/Driver/Driver_GPIO.h"
+#include "../Includes/Driver/Driver_SIM.h"
+#include "../Includes/Driver/Driver_DMA.h"
+
+/*******************************************************************************
+ * Header guard
+ ******************************************************************************/
+
+#ifndef _PIT_MODEL_H_
+#define _PIT_MODEL_H_
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+/*This header is included first in Driver_PIT.c and Driver_PWM.c, their inline register accesses go to the model*/
+#define _HAL_PIT_INLINE_H_
+#define _HAL_GPIO_INLINE_H_
+#define _DRIVER_PIT_INLINE_H_
+#define _DRIVER_GPIO_INLINE_H_
+
+#define HAL_PIT_TFLGn_read_TIF_fast HAL_PIT_TFLGn_read_TIF
+#define HAL_PIT_TFLGn_clear_TIF_fast HAL_PIT_TFLGn_set_TIF
+#define HAL_PIT_LDVALn_set_TSV_fast HAL_PIT_LDVALn_set_TSV
+#define HAL_PIT_CVALn_read_TVL_fast HAL_PIT_CVALn_read_TVL
+#define Driver_PIT_set_load_value_fast Driver_PIT_set_load_value
+#define Driver_PIT_read_current_value_fast Driver_PIT_read_current_value
+#define Driver_GPIO_set_port_pins_fast Driver_GPIO_set_port_pins
+#define Driver_GPIO_clear_port_pins_fast Driver_GPIO_clear_port_pins
+#define Driver_GPIO_set_pin_State_fast Driver_GPIO_set_pin_State
+
+#define PIT_MODEL_BUS_CLOCK (10485760u)     /*Bus clock of the board, the core clock divided by 2*/
+#define PIT_MODEL_PORT_COUNT (5u)           /*PORT A to PORT E*/
+#define PIT_MODEL_CORE_CLOCK (2u * PIT_MODEL_BUS_CLOCK)     /*Core clock of the board*/
+#define PIT_MODEL_EXCEPTION_CYCLES (30u)    /*Core cycles of a Cortex-M0+ exception entry and return*/
+#define PIT_MODEL_ACCESS_CYCLES (3u)        /*Core cycles of a register access through the peripheral bridge*/
+
+/*Count a failed check and print where it is*/
+#define PIT_MODEL_CHECK(condition)                                                  \
+    do                                                                              \
+    {                                                                               \
+        if (!(condition))                                                           \
+        {                                                                           \
+            PIT_model_failures++;                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);    \
+        }                                                                           \
+    } while (0)
+
+/*******************************************************************************
+ * Typedef
+ ******************************************************************************/
+
+/**
+ * @brief Function called after each write of a port, with the pins which changed
+ */
+typedef void (*PIT_model_pin_hook)(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Registers of one DMA channel, as the DMA driver set them
+ */
+typedef struct PIT_model_DMA
+{
+    uint8_t configured;         /*Driver_DMA_init accepted the channel*/
+    uint8_t triggered;          /*The DMAMUX routes the PIT trigger to the channel*/
+    uint32_t byte_count;        /*BCR*/
+    uint32_t source_address;    /*SAR*/
+    DMA_link_enum_t link;       /*DCR.LINKCC*/
+    uint8_t linked_channel;     /*DCR.LCH1*/
+    DMA_callback callback;      /*Called at the end of the transfer*/
+} PIT_model_DMA_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+extern uint64_t PIT_model_time;             /*Bus clock counts since the model was reset*/
+extern uint32_t PIT_model_interrupts;       /*Number of PIT interrupts taken*/
+extern uint32_t PIT_model_accesses;         /*Number of PIT and GPIO register accesses*/
+extern uint32_t PIT_model_port_output[PIT_MODEL_PORT_COUNT];    /*Output level of every pin*/
+extern PIT_model_pin_hook PIT_model_hook;   /*Called on every pin change, may be NULL*/
+extern uint32_t PIT_model_failures;         /*Number of failed checks*/
+extern PIT_model_DMA_info PIT_model_DMA[DMA_CHANNEL_COUNT];     /*State of each DMA channel*/
+extern uint64_t PIT_model_sleep_end;        /*A sleep with no timeout up to this time leaves by PIT_model_sleep_exit*/
+extern jmp_buf PIT_model_sleep_exit;        /*Set by the test before it runs a function which never returns*/
+extern uint32_t PIT_model_sleeps;           /*Number of sleeps in HAL_CORE_wait_for_IRQ*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Stop both timers, clear the pins and the counters and set the time to 0
+ *
+ * @return: this function return nothing.
+ */
+void PIT_model_reset(void);
+
+/**
+ * @brief Run the timers until a time, taking their interrupts at each timeout
+ *
+ * Each timer counts down from its load value and reloads the LDVAL written
+ * last when it reaches 0, so an LDVAL write applies to the next interval. The
+ * interrupt is taken at the timeout, each CVAL read in it lasts one count.
+ *
+ * @param end_time is the time to stop at, in bus clock counts since the reset
+ *
+ * @return: this function return nothing.
+ */
+void PIT_model_run_until(uint64_t end_time);
+
+/**
+ * @brief Run the timers until a number of PIT interrupts are taken, or no timer runs
+ *
+ * @param interrupts is the number of interrupts to take
+ *
+ * @return: this function return nothing.
+ */
+void PIT_model_run_interrupts(uint32_t interrupts);
+
+/**
+ * @brief Read the output level of a pin
+ *
+ * @param port_type is the port of the pin
+ * @param pin is the pin number
+ *
+ * @return 1 if the pin is high, 0 if it is low.
+ */
+uint8_t PIT_model_read_pin(Port_type_enum_t port_type, uint8_t pin);
+
+#endif /* _PIT_MODEL_H_ */
+/*EOF*/
@@ -0,0 +1,152 @@
+/**
+ * @file  : test_PIT_rate.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the load values and errors of the PIT rate calculator against exact arithmetic.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include <math.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_FREQUENCY_COUNT (10u)      /*Frequencies of the sweep*/
+#define TEST_FRACTION_ONE (65536.0)     /*A count in the unit of the fraction*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Check the 100 kHz example of the README at the bus clock of the board
+ *
+ * @return: this function return nothing.
+ */
+static void test_example(void);
+
+/**
+ * @brief Check the load values and errors of a sweep of frequencies
+ *
+ * @return: this function return nothing.
+ */
+static void test_sweep(void);
+
+/**
+ * @brief Check that the calculator rejects the inputs out of range
+ *
+ * @return: this function return nothing.
+ */
+static void test_range(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: test_example
+* Description: 100 kHz does not divide 10485760 Hz, the nearest interval is
+*              105 counts
+*
+END***************************************************************************/
+static void test_example(void)
+{
+    PIT_rate_info rate = {0};   /*Load values of 100 kHz*/
+
+    PIT_MODEL_CHECK(1 == Driver_PIT_calculate_rate(100000u, PIT_MODEL_BUS_CLOCK, &rate));
+    PIT_MODEL_CHECK((104u == rate.load_value) && (99864u == rate.achieved_frequency) && (-1356 == rate.error_ppm));
+    PIT_MODEL_CHECK((103u == rate.fractional_load_value) && (56204u == rate.fraction) &&
+                    (-47 == rate.fractional_error_ppb));
+    PIT_MODEL_CHECK(104u == PIT_LOAD_VALUE(PIT_MODEL_BUS_CLOCK, 100000u));
+
+    printf("100 kHz at %u Hz: LDVAL %u (%u Hz, %d ppm) or %u + %u/65536 (%d ppb)\n",
+           (unsigned int)PIT_MODEL_BUS_CLOCK, (unsigned int)rate.load_value, (unsigned int)rate.achieved_frequency,
+           (int)rate.error_ppm, (unsigned int)rate.fractional_load_value, (unsigned int)rate.fraction,
+           (int)rate.fractional_error_ppb);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_sweep
+* Description: The whole interval is the rounded exact one, the fractional
+*              one is within half a step of 1/65536 count, and both errors
+*              match the exact ones to the rounding
+*
+END***************************************************************************/
+static void test_sweep(void)
+{
+    static const uint32_t frequencies[TEST_FREQUENCY_COUNT] = {
+        1u, 50u, 1000u, 1234u, 20000u, 100000u, 999983u, 3000000u, PIT_MODEL_BUS_CLOCK / 2u, PIT_MODEL_BUS_CLOCK,
+    };
+    PIT_rate_info rate = {0};   /*Load values of the frequency*/
+    double exact = 0.0;         /*Exact interval in counts*/
+    double interval = 0.0;      /*Average interval of the fractional load value in counts*/
+    uint32_t index = 0;         /*Frequency index*/
+
+    for (index = 0; index < TEST_FREQUENCY_COUNT; index++)
+    {
+        exact = (double)PIT_MODEL_BUS_CLOCK / (double)frequencies[index];
+        PIT_MODEL_CHECK(1 == Driver_PIT_calculate_rate(frequencies[index], PIT_MODEL_BUS_CLOCK, &rate));
+
+        PIT_MODEL_CHECK((rate.load_value + 1u) == (uint32_t)floor(exact + 0.5));
+        PIT_MODEL_CHECK(rate.load_value == PIT_LOAD_VALUE(PIT_MODEL_BUS_CLOCK, frequencies[index]));
+        PIT_MODEL_CHECK(fabs((double)rate.achieved_frequency - (PIT_MODEL_BUS_CLOCK / (rate.load_value + 1.0))) <=
+                        0.5);
+        PIT_MODEL_CHECK(fabs(rate.error_ppm - (((exact / (rate.load_value + 1.0)) - 1.0) * 1e6)) <= 0.5);
+
+        interval = rate.fractional_load_value + 1.0 + (rate.fraction / TEST_FRACTION_ONE);
+        PIT_MODEL_CHECK(fabs(interval - exact) <= (0.5 / TEST_FRACTION_ONE));
+        PIT_MODEL_CHECK(fabs(rate.fractional_error_ppb - (((exact / interval) - 1.0) * 1e9)) <= 0.5);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_range
+* Description: A zero frequency, one above the bus clock or no output is
+*              rejected and leaves the output unchanged
+*
+END***************************************************************************/
+static void test_range(void)
+{
+    PIT_rate_info rate = {0};   /*Output, it must not be written*/
+
+    rate.load_value = 7u;
+    PIT_MODEL_CHECK(0 == Driver_PIT_calculate_rate(0, PIT_MODEL_BUS_CLOCK, &rate));
+    PIT_MODEL_CHECK(0 == Driver_PIT_calculate_rate(PIT_MODEL_BUS_CLOCK + 1u, PIT_MODEL_BUS_CLOCK, &rate));
+    PIT_MODEL_CHECK(0 == Driver_PIT_calculate_rate(100000u, PIT_MODEL_BUS_CLOCK, NULL));
+    PIT_MODEL_CHECK(7u == rate.load_value);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_example();
+    test_sweep();
+    test_range();
+
+    printf("test_PIT_rate: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
@@ -0,0 +1,239 @@
+/**
+ * @file  : test_PWM_chained.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the edge times of a chained timebase group and the lifetime timer on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+#include "../Includes/Driver/Driver_PIT.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PORT (PORT_E)          /*Port of the output pin*/
+#define TEST_PIN (1u)               /*Output pin*/
+#define TEST_PERIOD_MS (60000u)     /*One minute period*/
+#define TEST_RESOLUTION (100u)      /*Duty steps per period*/
+#define TEST_DUTY (25u)             /*Duty of the channel*/
+#define TEST_PERIODS (3u)           /*Periods checked*/
+#define TEST_LIFETIME_COUNTS (3ull * 0x100000000ull + 12345u)   /*Bus clocks measured, past three lower word wraps*/
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static uint64_t rise_times[TEST_PERIODS + 1u];  /*Times the pin went high*/
+static uint64_t fall_times[TEST_PERIODS + 1u];  /*Times the pin went low*/
+static uint32_t rise_count = 0;                 /*Number of rising edges recorded*/
+static uint32_t fall_count = 0;                 /*Number of falling edges recorded*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Record the time of each edge of the output pin
+ *
+ * @param port_type is the port written
+ * @param changed_pins is the mask of the pins which changed
+ *
+ * @return: this function return nothing.
+ */
+static void record_edge(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/**
+ * @brief Check the pulses and the interrupts of a one minute period on the chained PIT timers
+ *
+ * @return: this function return nothing.
+ */
+static void test_long_period(void);
+
+/**
+ * @brief Check that the lifetime timer waits for the timers of a group and then counts the bus clock
+ *
+ * @return: this function return nothing.
+ */
+static void test_lifetime(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: record_edge
+* Description: Record the time of each edge of the output pin
+*
+END***************************************************************************/
+static void record_edge(Port_type_enum_t port_type, uint32_t changed_pins)
+{
+    if ((TEST_PORT == port_type) && (0 != (changed_pins & (1u << TEST_PIN))))
+    {
+        if ((1 == PIT_model_read_pin(TEST_PORT, TEST_PIN)) && (rise_count <= TEST_PERIODS))
+        {
+            rise_times[rise_count] = PIT_model_time;
+            rise_count++;
+        }
+        else if ((0 == PIT_model_read_pin(TEST_PORT, TEST_PIN)) && (fall_count <= TEST_PERIODS))
+        {
+            fall_times[fall_count] = PIT_model_time;
+            fall_count++;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_long_period
+* Description: The one minute period does not fit the 16.16 step length on
+*              the bus clock. PIT0 divides the bus clock, so the period and
+*              the pulse are exact to one prescaler count, and only PIT1
+*              interrupts, twice per period.
+*
+END***************************************************************************/
+static void test_long_period(void)
+{
+    PWM_channel_config_info channel = {
+        .port_type = TEST_PORT,
+        .pin = TEST_PIN,
+        .active_state = HIGH_STATE,
+    };
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .timer_index = PWM_CHAIN_TIMER,
+        .output_stage = PWM_OUTPUT_ISR,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .channel_count = 1,
+        .channels = &channel,
+    };
+    uint64_t period_clocks = ((uint64_t)TEST_PERIOD_MS * PIT_MODEL_BUS_CLOCK) / 1000u;  /*Period in bus clocks*/
+    uint64_t period = 0;    /*Period of the chained timers in bus clocks*/
+    uint32_t edge = 0;      /*Edge index*/
+    uint32_t fall = 0;      /*Index of the falling edge of the pulse*/
+
+    PIT_model_reset();
+    PIT_MODEL_CHECK(PWM_STATUS_OK == Driver_PWM_config_long_period(&config, TEST_PERIOD_MS, TEST_RESOLUTION));
+    PIT_MODEL_CHECK(PWM_TIMEBASE_CHAINED == config.timebase);
+
+    /*The smallest prescaler which keeps a duty step in 16 bits*/
+    PIT_MODEL_CHECK(((config.period_counts / TEST_RESOLUTION) <= PWM_MAX_STEP_COUNTS) &&
+                    ((((uint64_t)config.period_counts * config.chain_prescaler) / (config.chain_prescaler - 1u)) >
+                     ((uint64_t)TEST_RESOLUTION * PWM_MAX_STEP_COUNTS)));
+    period = (uint64_t)config.period_counts * config.chain_prescaler;
+    PIT_MODEL_CHECK(llabs((long long)period - (long long)period_clocks) <= (long long)(config.chain_prescaler / 2u));
+
+    Driver_PWM_init(&config);
+    PIT_model_hook = record_edge;
+    Driver_PWM_set_duty(PWM_CHAIN_TIMER, 0, TEST_DUTY);
+    PIT_model_run_until(2u * period);
+
+    rise_count = 0;
+    fall_count = 0;
+    PIT_model_interrupts = 0;
+    PIT_model_run_until(PIT_model_time + (TEST_PERIODS * period));
+    PIT_MODEL_CHECK((TEST_PERIODS == rise_count) && (TEST_PERIODS == fall_count));
+    PIT_MODEL_CHECK((2u * TEST_PERIODS) == PIT_model_interrupts);
+
+    /*The window may start inside a pulse, its first falling edge then ends the pulse before*/
+    fall = ((0 != fall_count) && (0 != rise_count) && (fall_times[0] < rise_times[0])) ? 1u : 0u;
+
+    for (edge = 0; edge < rise_count; edge++)
+    {
+        PIT_MODEL_CHECK((0 == edge) || (period == (rise_times[edge] - rise_times[edge - 1u])));
+
+        if ((edge + fall) < fall_count)
+        {
+            PIT_MODEL_CHECK(llabs((long long)(fall_times[edge + fall] - rise_times[edge]) -
+                                  (long long)((period * TEST_DUTY) / TEST_RESOLUTION)) <=
+                            (long long)config.chain_prescaler);
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+
+    printf("%u ms period: prescaler %u, %u PIT counts, pulse %llu bus clocks\n", (unsigned int)TEST_PERIOD_MS,
+           (unsigned int)config.chain_prescaler, (unsigned int)config.period_counts,
+           (unsigned long long)((fall < fall_count) ? (fall_times[fall] - rise_times[0]) : 0u));
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_lifetime
+* Description: The chained group of test_long_period still holds both timers.
+*              Each read of the lifetime timer lasts two counts on the model.
+*
+END***************************************************************************/
+static void test_lifetime(void)
+{
+    uint64_t start = 0; /*Lifetime value at the start of the window*/
+    uint64_t delta = 0; /*Bus clocks counted in the window*/
+
+    PIT_model_hook = NULL;
+    PIT_MODEL_CHECK(0 == Driver_PIT_start_lifetime_timer());
+    PIT_MODEL_CHECK((0 == Driver_PIT_read_lifetime()) && (0 == Driver_PIT_counts_to_us(PIT_MODEL_BUS_CLOCK)));
+
+    Driver_PIT_release_timer(1);
+    PIT_MODEL_CHECK(0 == Driver_PIT_start_lifetime_timer());
+    Driver_PIT_release_timer(0);
+    PIT_MODEL_CHECK(1 == Driver_PIT_start_lifetime_timer());
+    PIT_MODEL_CHECK(1 == Driver_PIT_start_lifetime_timer());
+
+    PIT_model_interrupts = 0;
+    start = Driver_PIT_read_lifetime();
+    PIT_model_run_until(PIT_model_time + TEST_LIFETIME_COUNTS);
+    delta = Driver_PIT_read_lifetime() - start;
+    PIT_MODEL_CHECK((delta >= TEST_LIFETIME_COUNTS) && (delta <= (TEST_LIFETIME_COUNTS + 2u)));
+    PIT_MODEL_CHECK(0 == PIT_model_interrupts);
+
+    PIT_MODEL_CHECK(1000000u == Driver_PIT_counts_to_us(PIT_MODEL_BUS_CLOCK));
+    PIT_MODEL_CHECK(286u == Driver_PIT_counts_to_ns(3u));
+    PIT_MODEL_CHECK((TEST_LIFETIME_COUNTS * 1000000000ull) / PIT_MODEL_BUS_CLOCK ==
+                    Driver_PIT_counts_to_ns(TEST_LIFETIME_COUNTS));
+
+    printf("Lifetime timer: %llu bus clocks, %llu us\n", (unsigned long long)delta,
+           (unsigned long long)Driver_PIT_counts_to_us(delta));
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_long_period();
+    test_lifetime();
+
+    printf("test_PWM_chained: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
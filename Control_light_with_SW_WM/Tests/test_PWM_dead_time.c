@@ -0,0 +1,239 @@
+/**
+ * @file  : test_PWM_dead_time.c
+ * @author: Nguyen The Anh.
+ * @brief : Sweep the duty of complementary pairs on the PIT model and check their dead time.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+#include <stdlib.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PORT (PORT_E)          /*Port of the output pins*/
+#define TEST_CHANNELS (4u)          /*Two pairs*/
+#define TEST_DEAD_COUNTS (20u)      /*Dead time in PIT counts*/
+#define TEST_DEAD_NS (1000u)        /*Dead time in nanoseconds*/
+#define TEST_DEAD_NS_COUNTS (11u)   /*1000 ns at the bus clock is 10.49 counts, rounded up*/
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+/*Pair A: an active high side and an active low low side. Pair B: an active low center aligned side and an active
+  high low side.*/
+static PWM_channel_config_info test_channels[TEST_CHANNELS] = {
+    {PORT_E, 1, HIGH_STATE, 0, PWM_ALIGN_EDGE, PWM_PAIR_NONE},
+    {PORT_E, 2, LOW_STATE, 0, PWM_ALIGN_EDGE, PWM_PAIR_LOW_SIDE},
+    {PORT_E, 3, LOW_STATE, 0, PWM_ALIGN_CENTER, PWM_PAIR_NONE},
+    {PORT_E, 4, HIGH_STATE, 0, PWM_ALIGN_EDGE, PWM_PAIR_LOW_SIDE},
+};
+
+static uint8_t armed = 0;                       /*1 while the edges are checked*/
+static uint8_t was_on[TEST_CHANNELS];           /*On state of each side at the last write*/
+static uint64_t off_time[TEST_CHANNELS];        /*Time each side last turned off*/
+static uint32_t required_gap = 0;               /*Shortest time from a turn off to the turn on of the partner*/
+static uint32_t shortest_gap = 0;               /*Shortest time seen from a turn off to the turn on of the partner*/
+static uint32_t turn_ons = 0;                   /*Number of turn ons checked*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Read whether a side drives its switch on
+ *
+ * @param channel is the channel of the side
+ *
+ * @return 1 if the pin is at its active level.
+ */
+static uint8_t is_on(uint8_t channel);
+
+/**
+ * @brief Check the pairs after each write of the port
+ *
+ * @param port_type is the port written
+ * @param changed_pins is the mask of the pins which changed
+ *
+ * @return: this function return nothing.
+ */
+static void check_pairs(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/**
+ * @brief Sweep the duty of both pairs with random changes of pair A
+ *
+ * @param mode is the PWM mode
+ * @param resolution is the number of duty steps
+ * @param period_counts is the period in PIT counts
+ * @param dead_time is the dead time of the configuration
+ * @param dead_time_unit is the unit of the dead time
+ *
+ * @return: this function return nothing.
+ */
+static void sweep(PWM_mode_type_enum_t mode, uint32_t resolution, uint32_t period_counts,
+                  uint32_t dead_time, PWM_dead_time_unit_enum_t dead_time_unit);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: is_on
+* Description: Read whether a side drives its switch on
+*
+END***************************************************************************/
+static uint8_t is_on(uint8_t channel)
+{
+    uint8_t level = PIT_model_read_pin(TEST_PORT, test_channels[channel].pin);   /*Level of the pin*/
+
+    return (uint8_t)((HIGH_STATE == test_channels[channel].active_state) ? level : (1u - level));
+}
+
+/*Functions*********************************************************************
+*
+* Function name: check_pairs
+* Description: Both sides of a pair are never on together, and a side turns
+*              on the dead time after its partner turned off
+*
+END***************************************************************************/
+static void check_pairs(Port_type_enum_t port_type, uint32_t changed_pins)
+{
+    uint8_t channel = 0;    /*Channel index*/
+    uint8_t on = 0;         /*On state of the side*/
+    uint32_t gap = 0;       /*Time since the partner turned off*/
+
+    (void)changed_pins;
+
+    for (channel = 0; (TEST_PORT == port_type) && (channel < TEST_CHANNELS); channel++)
+    {
+        on = is_on(channel);
+
+        if ((1 == armed) && (1 == on) && (0 == was_on[channel]))
+        {
+            gap = (uint32_t)(PIT_model_time - off_time[channel ^ 1u]);
+            PIT_MODEL_CHECK(gap >= required_gap);
+            PIT_MODEL_CHECK(0 == is_on(channel ^ 1u));
+            shortest_gap = (gap < shortest_gap) ? gap : shortest_gap;
+            turn_ons++;
+        }
+        else if ((0 == on) && (1 == was_on[channel]))
+        {
+            off_time[channel] = PIT_model_time;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        was_on[channel] = on;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: sweep
+* Description: Pair A sweeps up and pair B down, and one interrupt in seven
+*              writes a random duty to pair A, so the tables change at any
+*              edge. Every side starts on, as the pins are before an init.
+*
+END***************************************************************************/
+static void sweep(PWM_mode_type_enum_t mode, uint32_t resolution, uint32_t period_counts,
+                  uint32_t dead_time, PWM_dead_time_unit_enum_t dead_time_unit)
+{
+    uint32_t duty = 0;      /*Duty of pair A*/
+    uint32_t step = 0;      /*Interrupt index*/
+    uint8_t channel = 0;    /*Channel index*/
+    PWM_config_info config = {
+        .mode = mode,
+        .timer_index = 0,
+        .period_counts = period_counts,
+        .resolution = resolution,
+        .output_stage = PWM_OUTPUT_ISR,
+        .phase_mode = PWM_PHASE_SPREAD,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .dead_time = dead_time,
+        .dead_time_unit = dead_time_unit,
+        .channel_count = TEST_CHANNELS,
+        .channels = test_channels,
+    };
+
+    PIT_model_reset();
+    PIT_model_port_output[TEST_PORT] = 0x1Eu;
+    PIT_model_hook = check_pairs;
+    armed = 0;
+    Driver_PWM_init(&config);
+
+    for (channel = 0; channel < TEST_CHANNELS; channel++)
+    {
+        was_on[channel] = is_on(channel);
+        off_time[channel] = PIT_model_time;
+    }
+
+    armed = 1;
+    shortest_gap = 0xFFFFFFFFu;
+    turn_ons = 0;
+    srand(7);
+
+    for (duty = 0; duty <= resolution; duty++)
+    {
+        Driver_PWM_set_duty(0, 0, duty);
+        Driver_PWM_set_duty(0, 2, resolution - duty);
+
+        for (step = 0; step < (40u * ((PWM_TICK_MODE == mode) ? resolution : 3u)); step++)
+        {
+            if (0 == ((uint32_t)rand() % 7u))
+            {
+                Driver_PWM_set_duty(0, 0, (uint32_t)rand() % (resolution + 1u));
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            PIT_model_run_interrupts(1);
+        }
+    }
+
+    /*Both pairs switched at every duty*/
+    PIT_MODEL_CHECK(turn_ons > (4u * resolution));
+
+    printf("mode %u, dead time %u: %u turn ons, shortest gap %u counts\n", (unsigned int)mode,
+           (unsigned int)required_gap, (unsigned int)turn_ons, (unsigned int)shortest_gap);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the sweeps, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    required_gap = TEST_DEAD_COUNTS;
+    sweep(PWM_EDGE_MODE, 100u, 10486u, TEST_DEAD_COUNTS, PWM_DEAD_TIME_COUNTS);
+    sweep(PWM_TICK_MODE, 100u, 10000u, TEST_DEAD_COUNTS, PWM_DEAD_TIME_COUNTS);
+    sweep(PWM_BAM_MODE, 63u, 6300u, TEST_DEAD_COUNTS, PWM_DEAD_TIME_COUNTS);
+
+    required_gap = TEST_DEAD_NS_COUNTS;
+    sweep(PWM_EDGE_MODE, 100u, 10486u, TEST_DEAD_NS, PWM_DEAD_TIME_NS);
+
+    printf("test_PWM_dead_time: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
@@ -0,0 +1,149 @@
+/**
+ * @file  : test_PWM_dma.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the DMA channels the DMA mode sets up on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PORT (PORT_E)          /*Port of the output pins*/
+#define TEST_RESOLUTION (64u)       /*Duty steps, one DMA transfer each*/
+#define TEST_PERIOD (6400u)         /*100 counts per duty step*/
+#define TEST_LINKED_CHANNEL (2u)    /*DMA channel writing the clear masks of group 0*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Check the byte counts of the DMA channels of a group
+ *
+ * @param timer_index is the PIT timer of the group, also its triggered DMA channel
+ * @param byte_count is the byte count of the triggered channel at the init
+ * @param linked_count is the byte count of the linked channel at the init
+ *
+ * @return: this function return nothing.
+ */
+static void check_byte_counts(uint8_t timer_index, uint32_t byte_count, uint32_t linked_count);
+
+/**
+ * @brief Start the DMA mode on a PIT timer and check its DMA channels before and after a reload
+ *
+ * @param timer_index is the PIT timer of the group
+ *
+ * @return: this function return nothing.
+ */
+static void test_dma_channels(uint8_t timer_index);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: check_byte_counts
+* Description: Both counts fit in the 20-bit field. The triggered channel
+*              stops on a whole pattern buffer, and the linked channel has
+*              the larger count, so it never runs out first.
+*
+END***************************************************************************/
+static void check_byte_counts(uint8_t timer_index, uint32_t byte_count, uint32_t linked_count)
+{
+    PIT_model_DMA_info *triggered = &PIT_model_DMA[timer_index];  /*Channel writing the set masks*/
+    PIT_model_DMA_info *linked = &PIT_model_DMA[TEST_LINKED_CHANNEL + timer_index]; /*Channel writing the clear masks*/
+
+    PIT_MODEL_CHECK((1 == triggered->configured) && (1 == linked->configured));
+    PIT_MODEL_CHECK((triggered->byte_count <= DMA_MAX_BYTE_COUNT) && (linked->byte_count <= DMA_MAX_BYTE_COUNT));
+    PIT_MODEL_CHECK(0 == (triggered->byte_count % (4u * PWM_DMA_MAX_STEPS)));
+    PIT_MODEL_CHECK(linked->byte_count > triggered->byte_count);
+    PIT_MODEL_CHECK((byte_count == triggered->byte_count) && (linked_count == linked->byte_count));
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_dma_channels
+* Description: The PIT triggers the DMA channel of its index without
+*              interrupt, each transfer is linked to the clear mask channel.
+*              The end of transfer interrupt gives both the same counts.
+*
+END***************************************************************************/
+static void test_dma_channels(uint8_t timer_index)
+{
+    PWM_channel_config_info channels[2] = {
+        {TEST_PORT, 1, HIGH_STATE},
+        {TEST_PORT, 2, LOW_STATE},
+    };
+    PWM_config_info config = {
+        .mode = PWM_DMA_MODE,
+        .timer_index = timer_index,
+        .period_counts = TEST_PERIOD,
+        .resolution = TEST_RESOLUTION,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .channel_count = 2,
+        .channels = channels,
+    };
+    uint8_t linked_channel = TEST_LINKED_CHANNEL + timer_index;    /*Channel writing the clear masks*/
+    uint32_t byte_count = 0;    /*Byte count of the triggered channel at the init*/
+    uint32_t linked_count = 0;  /*Byte count of the linked channel at the init*/
+    uint32_t counter = 0;       /*Counter of the PIT timer*/
+
+    PIT_model_reset();
+    Driver_PWM_init(&config);
+
+    byte_count = PIT_model_DMA[timer_index].byte_count;
+    linked_count = PIT_model_DMA[linked_channel].byte_count;
+    check_byte_counts(timer_index, byte_count, linked_count);
+    PIT_MODEL_CHECK((1 == PIT_model_DMA[timer_index].triggered) && (0 == PIT_model_DMA[linked_channel].triggered));
+    PIT_MODEL_CHECK(DMA_LINK_EACH_TRANSFER == PIT_model_DMA[timer_index].link);
+    PIT_MODEL_CHECK(linked_channel == PIT_model_DMA[timer_index].linked_channel);
+
+    /*The PIT counts the duty steps and takes no interrupt*/
+    counter = Driver_PIT_read_current_value(timer_index);
+    PIT_model_run_until(PIT_model_time + (10u * TEST_PERIOD) + 1u);
+    PIT_MODEL_CHECK(counter != Driver_PIT_read_current_value(timer_index));
+    PIT_MODEL_CHECK(0 == PIT_model_interrupts);
+
+    /*End of the transfer*/
+    PIT_MODEL_CHECK(NULL != PIT_model_DMA[timer_index].callback);
+    PIT_model_DMA[timer_index].byte_count = 0;
+    PIT_model_DMA[linked_channel].byte_count = 0;
+    PIT_model_DMA[timer_index].callback();
+    check_byte_counts(timer_index, byte_count, linked_count);
+
+    printf("DMA group %u: byte counts 0x%X and 0x%X, limit 0x%X\n", (unsigned int)timer_index,
+           (unsigned int)byte_count, (unsigned int)linked_count, (unsigned int)DMA_MAX_BYTE_COUNT);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_dma_channels(0);
+    test_dma_channels(1);
+
+    printf("test_PWM_dma: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
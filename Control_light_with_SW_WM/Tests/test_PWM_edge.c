@@ -0,0 +1,701 @@
+/**
+ * @file  : test_PWM_edge.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the edge times of the edge and tick modes, of the fades and of two PWM groups on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PERIOD (10486u)        /*1 kHz at the bus clock*/
+#define TEST_TICK_PERIOD (10000u)   /*Tick mode period, a whole number of counts per step*/
+#define TEST_RESOLUTION (100u)      /*Duty steps per period*/
+#define TEST_PORT (PORT_E)          /*Port of the output pin*/
+#define TEST_PIN (1u)               /*Output pin*/
+#define TEST_PERIODS (10u)          /*Periods checked for each duty*/
+#define TEST_MAX_EDGES (64u)        /*Edges recorded in a run*/
+#define TEST_REFINED_PERIOD (20000u)    /*Refined tick period, 200 counts per step*/
+#define TEST_REFINED_BITS (8u)          /*Sub-step bits of the refined tick duty*/
+#define TEST_REFINED_DUTY (9549u)       /*37.3008 % with 8 sub-step bits, 7460.16 counts*/
+#define TEST_REFINED_PERIODS (50u)      /*Periods checked in the refined tick runs*/
+#define TEST_FADE_MS (41u)              /*Length of the fades*/
+#define TEST_FADE_PERIODS (40u)         /*41 ms is 40.998 periods of TEST_PERIOD, the fade takes 40*/
+#define TEST_GROUP_PIN (2u)             /*Output pin of the PWM group on PIT timer 1*/
+#define TEST_GROUP_PERIOD (524u)        /*20 kHz at the bus clock*/
+#define TEST_GROUP_NEW_PERIOD (1048u)   /*10 kHz at the bus clock*/
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static uint64_t rise_times[TEST_MAX_EDGES];     /*Times the pin went high*/
+static uint64_t fall_times[TEST_MAX_EDGES];     /*Times the pin went low*/
+static uint32_t rise_count = 0;                 /*Number of rising edges recorded*/
+static uint32_t fall_count = 0;                 /*Number of falling edges recorded*/
+static PWM_tick_output_enum_t tick_output = PWM_TICK_COMPARE;   /*Tick mode output of start_channel*/
+static uint8_t edge_pin = TEST_PIN;             /*Pin whose edges are recorded*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Record the time of each edge of edge_pin
+ *
+ * @param port_type is the port written
+ * @param changed_pins is the mask of the pins which changed
+ *
+ * @return: this function return nothing.
+ */
+static void record_edge(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/**
+ * @brief Find the length of the pulse which starts at a rising edge
+ *
+ * @param rise is the index of the rising edge
+ *
+ * @return the time to the next falling edge, 0 if none was recorded.
+ */
+static uint32_t pulse_length(uint32_t rise);
+
+/**
+ * @brief Check the length of a pulse against the duty
+ *
+ * @param pulse is the length of the pulse in PIT counts
+ * @param duty is the duty of the channel
+ * @param period_counts is the period in PIT counts
+ *
+ * @return 1 if the pulse lasts duty / resolution of the period, to the count.
+ */
+static uint8_t is_duty_pulse(uint32_t pulse, uint32_t duty, uint32_t period_counts);
+
+/**
+ * @brief Start one channel on PIT timer 0 with the output on TEST_PIN
+ *
+ * @param mode is the PWM mode
+ * @param period_counts is the period in PIT counts
+ *
+ * @return: this function return nothing.
+ */
+static void start_channel(PWM_mode_type_enum_t mode, uint32_t period_counts);
+
+/**
+ * @brief Run whole periods after the duty is latched and record their edges
+ *
+ * @param duty is the duty of the channel
+ * @param period_counts is the period in PIT counts
+ *
+ * @return: this function return nothing.
+ */
+static void run_duty(uint32_t duty, uint32_t period_counts);
+
+/**
+ * @brief Check the edges of every duty in edge mode
+ *
+ * @return: this function return nothing.
+ */
+static void test_edge_mode(void);
+
+/**
+ * @brief Check that a duty written at any time of the period is applied from a period start
+ *
+ * @return: this function return nothing.
+ */
+static void test_duty_change(void);
+
+/**
+ * @brief Check the edges of every duty in tick mode
+ *
+ * @return: this function return nothing.
+ */
+static void test_tick_mode(void);
+
+/**
+ * @brief Compare the pulses of a sub-step duty with the fractional and the refined tick resolution
+ *
+ * @return: this function return nothing.
+ */
+static void test_refined_tick(void);
+
+/**
+ * @brief Check the pulses of a fade from 0 % to 100 % with each easing curve
+ *
+ * @return: this function return nothing.
+ */
+static void test_fade(void);
+
+/**
+ * @brief Check that a PWM group on PIT timer 1 runs beside the one on PIT timer 0 and restarts without
+ *        disturbing it
+ *
+ * @return: this function return nothing.
+ */
+static void test_two_groups(void);
+
+/**
+ * @brief Start one edge mode channel on PIT timer 1 with the output on TEST_GROUP_PIN
+ *
+ * @param period_counts is the period in PIT counts
+ * @param duty is the duty of the channel
+ *
+ * @return: this function return nothing.
+ */
+static void start_group(uint32_t period_counts, uint32_t duty);
+
+/**
+ * @brief Check the recorded pulses of a channel
+ *
+ * @param duty is the duty of the channel
+ * @param period_counts is the period in PIT counts
+ *
+ * @return: this function return nothing.
+ */
+static void check_pulses(uint32_t duty, uint32_t period_counts);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: record_edge
+* Description: Record the time of each edge of edge_pin
+*
+END***************************************************************************/
+static void record_edge(Port_type_enum_t port_type, uint32_t changed_pins)
+{
+    if ((TEST_PORT == port_type) && (0 != (changed_pins & (1u << edge_pin))))
+    {
+        if ((1 == PIT_model_read_pin(TEST_PORT, edge_pin)) && (rise_count < TEST_MAX_EDGES))
+        {
+            rise_times[rise_count] = PIT_model_time;
+            rise_count++;
+        }
+        else if ((0 == PIT_model_read_pin(TEST_PORT, edge_pin)) && (fall_count < TEST_MAX_EDGES))
+        {
+            fall_times[fall_count] = PIT_model_time;
+            fall_count++;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: pulse_length
+* Description: Find the length of the pulse which starts at a rising edge
+*
+END***************************************************************************/
+static uint32_t pulse_length(uint32_t rise)
+{
+    uint32_t fall = 0;      /*Falling edge index*/
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    while ((fall < fall_count) && (fall_times[fall] <= rise_times[rise]))
+    {
+        fall++;
+    }
+
+    if (fall < fall_count)
+    {
+        ret_val = (uint32_t)(fall_times[fall] - rise_times[rise]);
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: is_duty_pulse
+* Description: The engine rounds the counts of a step down to 1/65536 of a
+*              count, so a pulse may be one count shorter than the exact one
+*
+END***************************************************************************/
+static uint8_t is_duty_pulse(uint32_t pulse, uint32_t duty, uint32_t period_counts)
+{
+    uint32_t on_counts = (duty * period_counts) / TEST_RESOLUTION;  /*Exact on time, rounded down*/
+
+    return (uint8_t)((pulse == on_counts) || ((pulse + 1u) == on_counts));
+}
+
+/*Functions*********************************************************************
+*
+* Function name: start_channel
+* Description: Start one channel on PIT timer 0 with the output on TEST_PIN
+*
+END***************************************************************************/
+static void start_channel(PWM_mode_type_enum_t mode, uint32_t period_counts)
+{
+    PWM_channel_config_info channel = {
+        .port_type = TEST_PORT,
+        .pin = TEST_PIN,
+        .active_state = HIGH_STATE,
+    };
+    PWM_config_info config = {
+        .mode = mode,
+        .timer_index = 0,
+        .period_counts = period_counts,
+        .resolution = TEST_RESOLUTION,
+        .output_stage = PWM_OUTPUT_ISR,
+        .tick_output = tick_output,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .channel_count = 1,
+        .channels = &channel,
+    };
+
+    PIT_model_reset();
+    Driver_PWM_init(&config);
+    PIT_model_hook = record_edge;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: run_duty
+* Description: Two periods latch the duty, the edges of the next ones are
+*              recorded. The window is a whole number of periods, so it has
+*              the same interrupts whatever its phase.
+*
+END***************************************************************************/
+static void run_duty(uint32_t duty, uint32_t period_counts)
+{
+    Driver_PWM_set_duty(0, 0, duty);
+    PIT_model_run_until(PIT_model_time + (2u * period_counts));
+
+    rise_count = 0;
+    fall_count = 0;
+    PIT_model_interrupts = 0;
+    PIT_model_run_until(PIT_model_time + (TEST_PERIODS * period_counts));
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_edge_mode
+* Description: The pulses start one period apart and last duty / resolution
+*              of the period to one count, with two interrupts per period. The
+*              0 % and 100 % duties have no edge and stop the timer.
+*
+END***************************************************************************/
+static void test_edge_mode(void)
+{
+    uint32_t duty = 0;      /*Duty checked*/
+    uint32_t edge = 0;      /*Edge index*/
+
+    start_channel(PWM_EDGE_MODE, TEST_PERIOD);
+
+    for (duty = 0; duty <= TEST_RESOLUTION; duty++)
+    {
+        run_duty(duty, TEST_PERIOD);
+
+        if ((0 == duty) || (TEST_RESOLUTION == duty))
+        {
+            PIT_MODEL_CHECK((0 == rise_count) && (0 == fall_count));
+            PIT_MODEL_CHECK((0 == duty) == (0 == PIT_model_read_pin(TEST_PORT, TEST_PIN)));
+            PIT_MODEL_CHECK(0 == PIT_model_interrupts);
+        }
+        else
+        {
+            PIT_MODEL_CHECK((TEST_PERIODS == rise_count) && (TEST_PERIODS == fall_count));
+            PIT_MODEL_CHECK((2u * TEST_PERIODS) == PIT_model_interrupts);
+
+            for (edge = 0; edge < rise_count; edge++)
+            {
+                PIT_MODEL_CHECK((0 == edge) || (TEST_PERIOD == (rise_times[edge] - rise_times[edge - 1u])));
+                PIT_MODEL_CHECK((0 == pulse_length(edge)) ||
+                                (1 == is_duty_pulse(pulse_length(edge), duty, TEST_PERIOD)));
+            }
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_duty_change
+* Description: The pulses end after the old on time until a period start,
+*              then after the new one, whenever the duty is written
+*
+END***************************************************************************/
+static void test_duty_change(void)
+{
+    uint32_t change = 0;        /*Change index*/
+    uint32_t old_duty = 30;     /*Duty before the change*/
+    uint32_t new_duty = 0;      /*Duty after the change*/
+    uint32_t pulse = 0;         /*Length of a pulse*/
+    uint32_t edge = 0;          /*Edge index*/
+    uint8_t changed = 0;        /*1 once a pulse has the new duty*/
+
+    start_channel(PWM_EDGE_MODE, TEST_PERIOD);
+    run_duty(old_duty, TEST_PERIOD);
+    srand(1);
+
+    for (change = 0; change < 200u; change++)
+    {
+        new_duty = 1u + ((uint32_t)rand() % (TEST_RESOLUTION - 1u));
+        PIT_model_run_until(PIT_model_time + ((uint32_t)rand() % TEST_PERIOD));
+
+        rise_count = 0;
+        fall_count = 0;
+        Driver_PWM_set_duty(0, 0, new_duty);
+        PIT_model_run_until(PIT_model_time + (3u * TEST_PERIOD));
+        changed = 0;
+
+        /*The pulse running at the change has no recorded start*/
+        for (edge = 0; edge < rise_count; edge++)
+        {
+            pulse = pulse_length(edge);
+
+            if (1 == is_duty_pulse(pulse, new_duty, TEST_PERIOD))
+            {
+                changed = 1;
+            }
+            else if (0 != pulse)
+            {
+                /*A pulse of the old duty after one of the new duty is a mixed period*/
+                PIT_MODEL_CHECK(0 == changed);
+                PIT_MODEL_CHECK(1 == is_duty_pulse(pulse, old_duty, TEST_PERIOD));
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+        }
+
+        PIT_MODEL_CHECK(1 == changed);
+        old_duty = new_duty;
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_tick_mode
+* Description: Each pulse lasts a whole number of steps, with one interrupt
+*              per step. The table output moves the marks of the channel at
+*              each duty change and gives the same edges as the compare one.
+*
+END***************************************************************************/
+static void test_tick_mode(void)
+{
+    uint32_t duty = 0;  /*Duty checked*/
+    uint32_t edge = 0;  /*Edge index*/
+
+    for (tick_output = PWM_TICK_COMPARE; tick_output <= PWM_TICK_TABLE; tick_output++)
+    {
+        start_channel(PWM_TICK_MODE, TEST_TICK_PERIOD);
+
+        for (duty = 1; duty < TEST_RESOLUTION; duty++)
+        {
+            run_duty(duty, TEST_TICK_PERIOD);
+
+            PIT_MODEL_CHECK((TEST_PERIODS == rise_count) && (TEST_PERIODS == fall_count));
+            PIT_MODEL_CHECK((TEST_RESOLUTION * TEST_PERIODS) == PIT_model_interrupts);
+
+            for (edge = 0; edge < rise_count; edge++)
+            {
+                PIT_MODEL_CHECK((0 == edge) || (TEST_TICK_PERIOD == (rise_times[edge] - rise_times[edge - 1u])));
+                PIT_MODEL_CHECK((0 == pulse_length(edge)) ||
+                                (((duty * TEST_TICK_PERIOD) / TEST_RESOLUTION) == pulse_length(edge)));
+            }
+        }
+    }
+
+    tick_output = PWM_TICK_COMPARE;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_refined_tick
+* Description: The fractional tick dithers the duty by whole steps, so the
+*              pulse swings by 200 counts. The refined tick moves the pulse
+*              end by PIT counts, the pulse alternates between the two
+*              counts around the exact one and the period stays exact. Both
+*              keep the average on time.
+*
+END***************************************************************************/
+static void test_refined_tick(void)
+{
+    PWM_channel_config_info channel = {
+        .port_type = TEST_PORT,
+        .pin = TEST_PIN,
+        .active_state = HIGH_STATE,
+    };
+    PWM_config_info config = {
+        .mode = PWM_TICK_MODE,
+        .timer_index = 0,
+        .period_counts = TEST_REFINED_PERIOD,
+        .resolution = TEST_RESOLUTION,
+        .dither_bits = TEST_REFINED_BITS,
+        .output_stage = PWM_OUTPUT_ISR,
+        .phase_mode = PWM_PHASE_ALIGNED,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .channel_count = 1,
+        .channels = &channel,
+    };
+    uint64_t total = 0;         /*On time of the whole pulses*/
+    uint32_t pulses = 0;        /*Number of whole pulses*/
+    uint32_t pulse = 0;         /*Length of a pulse*/
+    uint32_t shortest[2] = {0xFFFFFFFFu, 0xFFFFFFFFu};  /*Shortest pulse of each resolution*/
+    uint32_t longest[2] = {0, 0};   /*Longest pulse of each resolution*/
+    uint32_t edge = 0;          /*Edge index*/
+    uint8_t run = 0;            /*0: fractional tick, 1: refined tick*/
+
+    for (run = 0; run < 2u; run++)
+    {
+        config.tick_resolution = (0 == run) ? PWM_TICK_FRACTIONAL : PWM_TICK_REFINED;
+        PIT_model_reset();
+        Driver_PWM_init(&config);
+        PIT_model_hook = record_edge;
+        Driver_PWM_set_duty(0, 0, TEST_REFINED_DUTY);
+        PIT_model_run_until(2u * TEST_REFINED_PERIOD);
+
+        rise_count = 0;
+        fall_count = 0;
+        PIT_model_interrupts = 0;
+        PIT_model_run_until(PIT_model_time + (TEST_REFINED_PERIODS * TEST_REFINED_PERIOD));
+        PIT_MODEL_CHECK((TEST_REFINED_PERIODS == rise_count) && (TEST_REFINED_PERIODS == fall_count));
+        PIT_MODEL_CHECK((TEST_RESOLUTION * TEST_REFINED_PERIODS) == PIT_model_interrupts);
+        total = 0;
+        pulses = 0;
+
+        /*The last pulse of the window has no falling edge*/
+        for (edge = 0; edge < rise_count; edge++)
+        {
+            pulse = pulse_length(edge);
+
+            if (0 != pulse)
+            {
+                total += pulse;
+                pulses++;
+                shortest[run] = (pulse < shortest[run]) ? pulse : shortest[run];
+                longest[run] = (pulse > longest[run]) ? pulse : longest[run];
+            }
+            else
+            {
+                /*Do nothing*/
+            }
+
+            PIT_MODEL_CHECK((0 == edge) || (TEST_REFINED_PERIOD == (rise_times[edge] - rise_times[edge - 1u])));
+        }
+
+        /*The on time, times the resolution and the sub-steps, is within one step of the whole step dither and
+          within one count of the refined tick*/
+        PIT_MODEL_CHECK(llabs((long long)((total * TEST_RESOLUTION) << TEST_REFINED_BITS) -
+                              (long long)((uint64_t)TEST_REFINED_DUTY * TEST_REFINED_PERIOD * pulses)) <=
+                        (long long)((((0 == run) ? (TEST_REFINED_PERIOD / TEST_RESOLUTION) : 1u) * TEST_RESOLUTION)
+                                    << TEST_REFINED_BITS));
+    }
+
+    PIT_MODEL_CHECK((7400u == shortest[0]) && (7600u == longest[0]));
+    PIT_MODEL_CHECK((7460u == shortest[1]) && (7461u == longest[1]));
+
+    printf("37.3008 %% duty: fractional tick pulse %u..%u counts, refined tick pulse %u..%u counts\n",
+           (unsigned int)shortest[0], (unsigned int)longest[0], (unsigned int)shortest[1], (unsigned int)longest[1]);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_fade
+* Description: Period k of the fade outputs the curve at k / TEST_FADE_PERIODS
+*              of the duty change, rounded down to a step. The periods below
+*              one step have no pulse. The last period lands on 100 %, the
+*              pin then stays high and the timer stops.
+*
+END***************************************************************************/
+static void test_fade(void)
+{
+    PWM_fade_curve_enum_t curve = PWM_FADE_LINEAR;  /*Easing curve checked*/
+    uint32_t edge = 0;      /*Edge index*/
+    uint32_t period = 0;    /*Period of the fade of a pulse, 1 to TEST_FADE_PERIODS*/
+    double progress = 0;    /*Elapsed part of the fade at the pulse*/
+    double part = 0;        /*Part of the duty change expected at the pulse*/
+    double expected = 0;    /*Exact length of the pulse*/
+
+    for (curve = PWM_FADE_LINEAR; curve <= PWM_FADE_S_CURVE; curve++)
+    {
+        start_channel(PWM_EDGE_MODE, TEST_PERIOD);
+        run_duty(0, TEST_PERIOD);
+
+        rise_count = 0;
+        fall_count = 0;
+        PIT_model_interrupts = 0;
+        Driver_PWM_fade(0, 0, TEST_RESOLUTION, TEST_FADE_MS, curve);
+        PIT_model_run_until(PIT_model_time + ((TEST_FADE_PERIODS + 2u) * TEST_PERIOD));
+
+        /*The last rise starts the period at 100 %*/
+        PIT_MODEL_CHECK((0 != rise_count) && ((rise_count - 1u) == fall_count));
+        PIT_MODEL_CHECK(1 == PIT_model_read_pin(TEST_PORT, TEST_PIN));
+        PIT_MODEL_CHECK((2u * TEST_FADE_PERIODS) >= PIT_model_interrupts);
+
+        for (edge = 0; edge < fall_count; edge++)
+        {
+            period = TEST_FADE_PERIODS - (uint32_t)((rise_times[rise_count - 1u] - rise_times[edge]) / TEST_PERIOD);
+            progress = (double)period / TEST_FADE_PERIODS;
+
+            if (PWM_FADE_EXPONENTIAL == curve)
+            {
+                part = (pow(2.0, PWM_FADE_EXP_OCTAVES * progress) - 1.0) / 255.0;
+            }
+            else if (PWM_FADE_S_CURVE == curve)
+            {
+                part = progress * progress * (3.0 - (2.0 * progress));
+            }
+            else
+            {
+                part = progress;
+            }
+
+            /*One step and one count below for the rounding down of the progress and of the step counts*/
+            expected = part * TEST_PERIOD;
+            PIT_MODEL_CHECK(((double)pulse_length(edge) <= (expected + 1.0)) &&
+                            ((double)pulse_length(edge) >= (expected - ((double)TEST_PERIOD / TEST_RESOLUTION) - 1.0)));
+            PIT_MODEL_CHECK((0 == edge) || (pulse_length(edge) >= pulse_length(edge - 1u)));
+        }
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: start_group
+* Description: The model and the group on PIT timer 0 are left running
+*
+END***************************************************************************/
+static void start_group(uint32_t period_counts, uint32_t duty)
+{
+    PWM_channel_config_info channel = {
+        .port_type = TEST_PORT,
+        .pin = TEST_GROUP_PIN,
+        .active_state = HIGH_STATE,
+    };
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .timer_index = 1,
+        .period_counts = period_counts,
+        .resolution = TEST_RESOLUTION,
+        .output_stage = PWM_OUTPUT_ISR,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .channel_count = 1,
+        .channels = &channel,
+    };
+
+    Driver_PWM_init(&config);
+    Driver_PWM_set_duty(1, 0, duty);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: check_pulses
+* Description: Every recorded pulse starts one period after the one before
+*              and lasts duty / resolution of the period, to one count
+*
+END***************************************************************************/
+static void check_pulses(uint32_t duty, uint32_t period_counts)
+{
+    uint32_t edge = 0;      /*Edge index*/
+
+    PIT_MODEL_CHECK((TEST_PERIODS == rise_count) && (TEST_PERIODS == fall_count));
+
+    /*The window starts and ends in a pulse, the last one has no falling edge*/
+    for (edge = 1; edge < rise_count; edge++)
+    {
+        PIT_MODEL_CHECK(1 == is_duty_pulse(pulse_length(edge - 1u), duty, period_counts));
+        PIT_MODEL_CHECK(period_counts == (rise_times[edge] - rise_times[edge - 1u]));
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_two_groups
+* Description: The group on PIT timer 0 keeps its pulses to the count while
+*              the group on PIT timer 1 runs at another period and is
+*              initialized again with a third one
+*
+END***************************************************************************/
+static void test_two_groups(void)
+{
+    start_channel(PWM_EDGE_MODE, TEST_PERIOD);
+    Driver_PWM_set_duty(0, 0, 30u);
+    start_group(TEST_GROUP_PERIOD, 70u);
+    PIT_model_run_until(PIT_model_time + (2u * TEST_PERIOD));
+
+    /*Group 1 is initialized again in the middle of the recorded periods of group 0*/
+    rise_count = 0;
+    fall_count = 0;
+    PIT_model_run_until(PIT_model_time + ((TEST_PERIODS / 2u) * TEST_PERIOD));
+    start_group(TEST_GROUP_NEW_PERIOD, 40u);
+    PIT_model_run_until(PIT_model_time + ((TEST_PERIODS / 2u) * TEST_PERIOD));
+    check_pulses(30u, TEST_PERIOD);
+
+    /*The new period of group 1, from its second period*/
+    edge_pin = TEST_GROUP_PIN;
+    rise_count = 0;
+    fall_count = 0;
+    PIT_model_run_until(PIT_model_time + (TEST_PERIODS * TEST_GROUP_NEW_PERIOD) - 1u);
+    check_pulses(40u, TEST_GROUP_NEW_PERIOD);
+    edge_pin = TEST_PIN;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_edge_mode();
+    test_duty_change();
+    test_tick_mode();
+    test_refined_tick();
+    test_fade();
+    test_two_groups();
+
+    printf("test_PWM_edge: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
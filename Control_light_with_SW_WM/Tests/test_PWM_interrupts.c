@@ -0,0 +1,478 @@
+/**
+ * @file  : test_PWM_interrupts.c
+ * @author: Nguyen The Anh.
+ * @brief : Count the interrupts and the modelled cycles of the BAM, phase and alignment modes on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PORT (PORT_E)          /*Port of the output pins, channel n is on pin n + 1*/
+#define TEST_CHANNELS (4u)          /*Channels of a run*/
+#define TEST_PERIODS (10u)          /*Periods counted*/
+#define TEST_BAM_RESOLUTION (255u)  /*8-bit frame*/
+#define TEST_BAM_PERIOD (25500u)    /*100 counts per duty step*/
+#define TEST_EDGE_RESOLUTION (100u) /*Duty steps of the edge mode*/
+#define TEST_EDGE_PERIOD (10000u)   /*100 counts per duty step*/
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static uint64_t last_write = 0;             /*Time of the last pin change*/
+static uint64_t on_time[TEST_CHANNELS];     /*On time of each channel since the start of the count*/
+static uint32_t last_interrupt = 0;         /*Interrupt of the last pin change*/
+static uint32_t interrupt_pins = 0;         /*Pins changed in the last interrupt*/
+static uint32_t most_pins = 0;              /*Most pins changed in one interrupt*/
+static PWM_align_enum_t alignment = PWM_ALIGN_EDGE;    /*Alignment of the channels of a run*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Count the bits set in a pin mask
+ *
+ * @param pins is the pin mask
+ *
+ * @return the number of pins in the mask.
+ */
+static uint32_t count_pins(uint32_t pins);
+
+/**
+ * @brief Add up the on time of the channels and the pins changed by each interrupt
+ *
+ * @param port_type is the port written
+ * @param changed_pins is the mask of the pins which changed
+ *
+ * @return: this function return nothing.
+ */
+static void record_pins(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/**
+ * @brief Start the channels on PIT timer 0
+ *
+ * @param config is the configuration, its channels are filled with the duties
+ * @param duties is the duty of each channel
+ * @param phases is the phase of each channel in duty steps
+ *
+ * @return: this function return nothing.
+ */
+static void start_channels(PWM_config_info *config, const uint32_t *duties, const uint32_t *phases);
+
+/**
+ * @brief Run whole periods after the duties are latched and count their interrupts and on times
+ *
+ * @param period_counts is the period in PIT counts
+ *
+ * @return: this function return nothing.
+ */
+static void run_periods(uint32_t period_counts);
+
+/**
+ * @brief Estimate the core cycles the interrupts of the count window take
+ *
+ * @return the exception entries and returns plus the register accesses, in core cycles.
+ */
+static uint32_t model_cycles(void);
+
+/**
+ * @brief Check that each channel was on for its duty in the count window
+ *
+ * @param duties is the duty of each channel
+ *
+ * @return: this function return nothing.
+ */
+static void check_on_times(const uint32_t *duties);
+
+/**
+ * @brief Compare the interrupts of the BAM and tick modes for the same 8-bit duties
+ *
+ * @return: this function return nothing.
+ */
+static void test_bam_mode(void);
+
+/**
+ * @brief Compare the interrupts and the pins switched together of the aligned and spread phases
+ *
+ * @return: this function return nothing.
+ */
+static void test_phase_spread(void);
+
+/**
+ * @brief Check the pulses which end at the period end
+ *
+ * @return: this function return nothing.
+ */
+static void test_phase_wrap(void);
+
+/**
+ * @brief Compare the pins switched together of the edge and center aligned channels
+ *
+ * @return: this function return nothing.
+ */
+static void test_center_alignment(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: count_pins
+* Description: Count the bits set in a pin mask
+*
+END***************************************************************************/
+static uint32_t count_pins(uint32_t pins)
+{
+    uint32_t ret_val = 0;   /*This variable stores the return value of the function*/
+
+    while (0 != pins)
+    {
+        ret_val += pins & 1u;
+        pins >>= 1;
+    }
+
+    return ret_val;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: record_pins
+* Description: The levels before the write give the on time since the last
+*              one. The pins of the set and clear writes of an interrupt are
+*              added up.
+*
+END***************************************************************************/
+static void record_pins(Port_type_enum_t port_type, uint32_t changed_pins)
+{
+    uint32_t old_levels = PIT_model_port_output[port_type] ^ changed_pins;  /*Levels before the write*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    if (TEST_PORT == port_type)
+    {
+        for (channel = 0; channel < TEST_CHANNELS; channel++)
+        {
+            on_time[channel] += ((old_levels >> (channel + 1u)) & 1u) * (PIT_model_time - last_write);
+        }
+
+        last_write = PIT_model_time;
+
+        if (last_interrupt != PIT_model_interrupts)
+        {
+            last_interrupt = PIT_model_interrupts;
+            interrupt_pins = 0;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+
+        interrupt_pins += count_pins(changed_pins);
+        most_pins = (interrupt_pins > most_pins) ? interrupt_pins : most_pins;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: start_channels
+* Description: Start the channels on PIT timer 0
+*
+END***************************************************************************/
+static void start_channels(PWM_config_info *config, const uint32_t *duties, const uint32_t *phases)
+{
+    static PWM_channel_config_info channel_config[TEST_CHANNELS];  /*Channel n is on pin n + 1*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < TEST_CHANNELS; channel++)
+    {
+        channel_config[channel] = (PWM_channel_config_info){TEST_PORT, (uint8_t)(channel + 1u), HIGH_STATE,
+                                                            phases[channel], alignment};
+    }
+
+    config->timer_index = 0;
+    config->output_stage = PWM_OUTPUT_ISR;
+    config->backend = PWM_BACKEND_SOFTWARE;
+    config->channel_count = TEST_CHANNELS;
+    config->channels = channel_config;
+
+    PIT_model_reset();
+    Driver_PWM_init(config);
+    PIT_model_hook = record_pins;
+
+    for (channel = 0; channel < TEST_CHANNELS; channel++)
+    {
+        Driver_PWM_set_duty(0, channel, duties[channel]);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: run_periods
+* Description: Two periods latch the duties. The count window is a whole
+*              number of periods, so it has the same interrupts and on times
+*              whatever its phase.
+*
+END***************************************************************************/
+static void run_periods(uint32_t period_counts)
+{
+    uint64_t end_time = 0;  /*End of the count window*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    PIT_model_run_until(PIT_model_time + (2u * period_counts));
+
+    for (channel = 0; channel < TEST_CHANNELS; channel++)
+    {
+        on_time[channel] = 0;
+    }
+
+    last_write = PIT_model_time;
+    PIT_model_interrupts = 0;
+    PIT_model_accesses = 0;
+    last_interrupt = 0;
+    most_pins = 0;
+    end_time = PIT_model_time + (TEST_PERIODS * period_counts);
+    PIT_model_run_until(end_time);
+
+    /*Close the window with the levels the pins have at its end*/
+    record_pins(TEST_PORT, 0);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: model_cycles
+* Description: The code of the interrupt handlers is not counted, so this is
+*              the least the interrupts can take
+*
+END***************************************************************************/
+static uint32_t model_cycles(void)
+{
+    return (PIT_model_interrupts * PIT_MODEL_EXCEPTION_CYCLES) + (PIT_model_accesses * PIT_MODEL_ACCESS_CYCLES);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: check_on_times
+* Description: Each duty step lasts 100 counts
+*
+END***************************************************************************/
+static void check_on_times(const uint32_t *duties)
+{
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < TEST_CHANNELS; channel++)
+    {
+        PIT_MODEL_CHECK(on_time[channel] == ((uint64_t)TEST_PERIODS * duties[channel] * 100u));
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_bam_mode
+* Description: BAM takes one interrupt per duty bit, tick mode one per duty
+*              step. Both keep each pin on for duty steps of each period. The
+*              modelled load is the share of the core clock the interrupts
+*              take at least.
+*
+END***************************************************************************/
+static void test_bam_mode(void)
+{
+    const uint32_t duties[TEST_CHANNELS] = {1u, 100u, 170u, 254u};  /*Every bit is set in some duty*/
+    const uint32_t phases[TEST_CHANNELS] = {0u, 0u, 0u, 0u};        /*BAM has fixed slots*/
+    PWM_config_info config = {
+        .mode = PWM_BAM_MODE,
+        .period_counts = TEST_BAM_PERIOD,
+        .resolution = TEST_BAM_RESOLUTION,
+    };
+    uint32_t bam_interrupts = 0;    /*Interrupts of the BAM mode in the window*/
+    uint32_t bam_cycles = 0;        /*Modelled core cycles of the BAM interrupts in the window*/
+    uint32_t window_cycles = TEST_PERIODS * TEST_BAM_PERIOD * (PIT_MODEL_CORE_CLOCK / PIT_MODEL_BUS_CLOCK);
+
+    start_channels(&config, duties, phases);
+    run_periods(TEST_BAM_PERIOD);
+    bam_interrupts = PIT_model_interrupts;
+    bam_cycles = model_cycles();
+    PIT_MODEL_CHECK((8u * TEST_PERIODS) == bam_interrupts);
+    check_on_times(duties);
+
+    config.mode = PWM_TICK_MODE;
+    start_channels(&config, duties, phases);
+    run_periods(TEST_BAM_PERIOD);
+    PIT_MODEL_CHECK((TEST_BAM_RESOLUTION * TEST_PERIODS) == PIT_model_interrupts);
+    PIT_MODEL_CHECK((10u * bam_cycles) < model_cycles());
+    check_on_times(duties);
+
+    printf("8-bit frame: BAM %u interrupts, %u cycles (%.2f %% load), tick %u interrupts, %u cycles (%.2f %% load)\n",
+           (unsigned int)(bam_interrupts / TEST_PERIODS), (unsigned int)(bam_cycles / TEST_PERIODS),
+           (100.0 * bam_cycles) / window_cycles, (unsigned int)(PIT_model_interrupts / TEST_PERIODS),
+           (unsigned int)(model_cycles() / TEST_PERIODS), (100.0 * model_cycles()) / window_cycles);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_phase_spread
+* Description: Aligned pulses start together, one interrupt turns every pin
+*              on and each duty adds one that turns its pin off. Spread
+*              pulses add an on and an off edge per shifted channel, and
+*              switch at most two pins together. The duties are the same.
+*
+END***************************************************************************/
+static void test_phase_spread(void)
+{
+    const uint32_t duties[TEST_CHANNELS] = {30u, 60u, 90u, 10u};   /*Duties of the channels*/
+    const uint32_t phases[TEST_CHANNELS] = {0u, 0u, 0u, 0u};        /*Set by the phase mode*/
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .period_counts = TEST_EDGE_PERIOD,
+        .resolution = TEST_EDGE_RESOLUTION,
+        .phase_mode = PWM_PHASE_ALIGNED,
+    };
+    uint32_t aligned_interrupts = 0;    /*Interrupts of the aligned phases in the window*/
+    uint32_t aligned_pins = 0;          /*Most pins changed in one interrupt with the aligned phases*/
+
+    start_channels(&config, duties, phases);
+    run_periods(TEST_EDGE_PERIOD);
+    aligned_interrupts = PIT_model_interrupts;
+    aligned_pins = most_pins;
+    PIT_MODEL_CHECK(((TEST_CHANNELS + 1u) * TEST_PERIODS) == aligned_interrupts);
+    PIT_MODEL_CHECK(TEST_CHANNELS == aligned_pins);
+    check_on_times(duties);
+
+    config.phase_mode = PWM_PHASE_SPREAD;
+    start_channels(&config, duties, phases);
+    run_periods(TEST_EDGE_PERIOD);
+    PIT_MODEL_CHECK((((2u * TEST_CHANNELS) - 1u) * TEST_PERIODS) == PIT_model_interrupts);
+    PIT_MODEL_CHECK(2u >= most_pins);
+    check_on_times(duties);
+
+    printf("4 channels: aligned %u interrupts and up to %u pins, spread %u interrupts and up to %u pins\n",
+           (unsigned int)(aligned_interrupts / TEST_PERIODS), (unsigned int)aligned_pins,
+           (unsigned int)(PIT_model_interrupts / TEST_PERIODS), (unsigned int)most_pins);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_phase_wrap
+* Description: A pulse whose start plus duty is the period ends at the
+*              period start edge, it is off from time 0 to its start. Spread
+*              phases start at 0, 25, 50 and 75 steps, the explicit phases at
+*              0, 10, 40 and 90 steps.
+*
+END***************************************************************************/
+static void test_phase_wrap(void)
+{
+    const uint32_t spread_duties[TEST_CHANNELS] = {30u, 75u, 50u, 25u};    /*Channels 1 to 3 end at the period end*/
+    const uint32_t explicit_duties[TEST_CHANNELS] = {20u, 90u, 60u, 10u};  /*Channels 1 to 3 end at the period end*/
+    const uint32_t no_phases[TEST_CHANNELS] = {0u, 0u, 0u, 0u};            /*Set by the phase mode*/
+    const uint32_t explicit_phases[TEST_CHANNELS] = {0u, 10u, 40u, 90u};   /*Pulse starts in duty steps*/
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .period_counts = TEST_EDGE_PERIOD,
+        .resolution = TEST_EDGE_RESOLUTION,
+        .phase_mode = PWM_PHASE_SPREAD,
+    };
+
+    /*Edges at 0, 25, 30, 50 and 75 steps*/
+    start_channels(&config, spread_duties, no_phases);
+    run_periods(TEST_EDGE_PERIOD);
+    PIT_MODEL_CHECK((5u * TEST_PERIODS) == PIT_model_interrupts);
+    check_on_times(spread_duties);
+
+    /*Edges at 0, 10, 20, 40 and 90 steps*/
+    config.phase_mode = PWM_PHASE_EXPLICIT;
+    start_channels(&config, explicit_duties, explicit_phases);
+    run_periods(TEST_EDGE_PERIOD);
+    PIT_MODEL_CHECK((5u * TEST_PERIODS) == PIT_model_interrupts);
+    check_on_times(explicit_duties);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_center_alignment
+* Description: With aligned phases, edge aligned pulses all start at the
+*              period start. Center aligned pulses of different duties start
+*              and end at different steps, so no interrupt switches two pins.
+*              The duties are the same.
+*
+END***************************************************************************/
+static void test_center_alignment(void)
+{
+    const uint32_t duties[TEST_CHANNELS] = {20u, 50u, 80u, 40u};   /*Duties of the channels*/
+    const uint32_t phases[TEST_CHANNELS] = {0u, 0u, 0u, 0u};        /*Set by the phase mode*/
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .period_counts = TEST_EDGE_PERIOD,
+        .resolution = TEST_EDGE_RESOLUTION,
+        .phase_mode = PWM_PHASE_ALIGNED,
+    };
+    uint32_t edge_pins = 0;     /*Most pins changed in one interrupt with the edge alignment*/
+
+    alignment = PWM_ALIGN_EDGE;
+    start_channels(&config, duties, phases);
+    run_periods(TEST_EDGE_PERIOD);
+    edge_pins = most_pins;
+    PIT_MODEL_CHECK(TEST_CHANNELS == edge_pins);
+    check_on_times(duties);
+
+    alignment = PWM_ALIGN_CENTER;
+    start_channels(&config, duties, phases);
+    run_periods(TEST_EDGE_PERIOD);
+    PIT_MODEL_CHECK(1u == most_pins);
+    check_on_times(duties);
+
+    printf("4 channels: up to %u pins switch together edge aligned, %u center aligned in %u interrupts\n",
+           (unsigned int)edge_pins, (unsigned int)most_pins, (unsigned int)(PIT_model_interrupts / TEST_PERIODS));
+
+    alignment = PWM_ALIGN_EDGE;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_bam_mode();
+    test_phase_spread();
+    test_phase_wrap();
+    test_center_alignment();
+
+    printf("test_PWM_interrupts: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
@@ -0,0 +1,457 @@
+/**
+ * @file  : test_PWM_spread.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the period lengths, the average duty and the spectrum of the spread modes on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_PWM.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_PERIOD (10486u)        /*1 kHz at the bus clock*/
+#define TEST_RESOLUTION (100u)      /*Duty steps per period*/
+#define TEST_PORT (PORT_E)          /*Port of the output pins, channel n is on pin n + 1*/
+#define TEST_CYCLE (2u * PWM_SPREAD_STEPS)  /*Periods of a triangle cycle*/
+#define TEST_SETTLE_PERIODS (TEST_CYCLE)    /*Periods run before the checks*/
+#define TEST_MAX_PERIODS (16384u)   /*Periods recorded in a run*/
+#define TEST_HARMONICS (5u)         /*Harmonics of the PWM frequency in the spectrum check*/
+#define TEST_PI (3.14159265358979323846)
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static uint8_t channel_count = 0;               /*Channels of the run*/
+static uint64_t last_write = 0;                 /*Time of the last pin change*/
+static uint64_t on_time[PWM_MAX_CHANNELS];      /*On time of each channel since the reset*/
+static uint64_t period_starts[TEST_MAX_PERIODS];    /*Times channel 0 turned on*/
+static uint64_t pulse_ends[TEST_MAX_PERIODS];       /*Times channel 0 turned off after each period start*/
+static uint64_t on_at_start[TEST_MAX_PERIODS][PWM_MAX_CHANNELS];  /*On time of each channel at each period start*/
+static uint32_t period_count = 0;               /*Number of period starts recorded*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Add up the on time of the channels and record the period starts
+ *
+ * @param port_type is the port written
+ * @param changed_pins is the mask of the pins which changed
+ *
+ * @return: this function return nothing.
+ */
+static void record_periods(Port_type_enum_t port_type, uint32_t changed_pins);
+
+/**
+ * @brief Start the phase spread channels on PIT timer 0
+ *
+ * @param spread_mode is the spread mode
+ * @param spread_permille is the highest period change in thousandths of the period
+ * @param channels is the number of channels
+ *
+ * @return: this function return nothing.
+ */
+static void start_channels(PWM_spread_enum_t spread_mode, uint16_t spread_permille, uint8_t channels);
+
+/**
+ * @brief Run until a number of periods are recorded
+ *
+ * @param periods is the number of period starts to reach
+ *
+ * @return: this function return nothing.
+ */
+static void run_periods(uint32_t periods);
+
+/**
+ * @brief Check the period lengths and the average duty at a fixed duty
+ *
+ * @param spread_mode is the spread mode
+ * @param channels is the number of channels
+ * @param duty is the duty of channel 0, channel n has 10 * n steps more
+ *
+ * @return: this function return nothing.
+ */
+static void test_fixed_duty(PWM_spread_enum_t spread_mode, uint8_t channels, uint32_t duty);
+
+/**
+ * @brief Check that the average period stays nominal while the spread limit changes with the duty
+ *
+ * @param spread_mode is the spread mode
+ *
+ * @return: this function return nothing.
+ */
+static void test_changing_limit(PWM_spread_enum_t spread_mode);
+
+/**
+ * @brief Compute the energy of the channel 0 waveform at a harmonic of the PWM frequency
+ *
+ * @param first is the first pulse of the window
+ * @param last is the pulse after the window
+ * @param harmonic is the harmonic number, 1 for the PWM frequency
+ *
+ * @return the squared magnitude of the Fourier transform of the window at the frequency.
+ */
+static double harmonic_energy(uint32_t first, uint32_t last, uint32_t harmonic);
+
+/**
+ * @brief Check that the spread modes lower the lines of the PWM frequency and its harmonics
+ *
+ * @return: this function return nothing.
+ */
+static void test_spectrum(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: record_periods
+* Description: The levels before the write give the on time since the last
+*              one, channel 0 has phase 0 so it turns on at each period start
+*
+END***************************************************************************/
+static void record_periods(Port_type_enum_t port_type, uint32_t changed_pins)
+{
+    uint32_t old_levels = PIT_model_port_output[port_type] ^ changed_pins;  /*Levels before the write*/
+    uint8_t channel = 0;    /*Channel index*/
+
+    if (TEST_PORT == port_type)
+    {
+        for (channel = 0; channel < channel_count; channel++)
+        {
+            on_time[channel] += ((old_levels >> (channel + 1u)) & 1u) * (PIT_model_time - last_write);
+        }
+
+        last_write = PIT_model_time;
+
+        if ((0 != (changed_pins & 2u)) && (1 == PIT_model_read_pin(TEST_PORT, 1)) &&
+            (period_count < TEST_MAX_PERIODS))
+        {
+            period_starts[period_count] = PIT_model_time;
+
+            for (channel = 0; channel < channel_count; channel++)
+            {
+                on_at_start[period_count][channel] = on_time[channel];
+            }
+
+            period_count++;
+        }
+        else if ((0 != (changed_pins & 2u)) && (0 != period_count) && (period_count <= TEST_MAX_PERIODS))
+        {
+            pulse_ends[period_count - 1u] = PIT_model_time;
+        }
+        else
+        {
+            /*Do nothing*/
+        }
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: start_channels
+* Description: Start the phase spread channels on PIT timer 0
+*
+END***************************************************************************/
+static void start_channels(PWM_spread_enum_t spread_mode, uint16_t spread_permille, uint8_t channels)
+{
+    PWM_channel_config_info channel_config[PWM_MAX_CHANNELS];   /*Channel n is on pin n + 1*/
+    PWM_config_info config = {
+        .mode = PWM_EDGE_MODE,
+        .timer_index = 0,
+        .period_counts = TEST_PERIOD,
+        .resolution = TEST_RESOLUTION,
+        .output_stage = PWM_OUTPUT_ISR,
+        .phase_mode = PWM_PHASE_SPREAD,
+        .backend = PWM_BACKEND_SOFTWARE,
+        .spread_mode = spread_mode,
+        .spread_permille = spread_permille,
+        .channel_count = channels,
+        .channels = channel_config,
+    };
+    uint8_t channel = 0;    /*Channel index*/
+
+    for (channel = 0; channel < channels; channel++)
+    {
+        channel_config[channel] = (PWM_channel_config_info){TEST_PORT, (uint8_t)(channel + 1u), HIGH_STATE};
+        on_time[channel] = 0;
+    }
+
+    PIT_model_reset();
+    channel_count = channels;
+    last_write = 0;
+    period_count = 0;
+    Driver_PWM_init(&config);
+    PIT_model_hook = record_periods;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: run_periods
+* Description: Run until a number of periods are recorded
+*
+END***************************************************************************/
+static void run_periods(uint32_t periods)
+{
+    while (period_count < periods)
+    {
+        PIT_model_run_interrupts(1);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_fixed_duty
+* Description: Each period is within the spread of the nominal one. The
+*              triangle changes sum to 0 over any cycle, and the random sum
+*              stays within PWM_SPREAD_STEPS + 1 periods of spread. The
+*              spread moves no channel away from its duty.
+*
+END***************************************************************************/
+static void test_fixed_duty(PWM_spread_enum_t spread_mode, uint8_t channels, uint32_t duty)
+{
+    uint32_t spread_counts = (TEST_PERIOD * 50u) / 1000u;  /*Highest period change*/
+    uint32_t first = TEST_SETTLE_PERIODS;   /*First period checked*/
+    uint32_t last = TEST_SETTLE_PERIODS + (40u * TEST_CYCLE);  /*Period start after the last period checked*/
+    uint32_t period = 0;        /*Period index*/
+    uint32_t length = 0;        /*Length of a period*/
+    uint32_t shortest = 0xFFFFFFFFu;    /*Shortest period*/
+    uint32_t longest = 0;       /*Longest period*/
+    int64_t drift = 0;          /*Time of a period start minus its nominal time*/
+    double measured = 0;        /*Average duty of a channel*/
+    double tolerance = 0;       /*Largest duty error*/
+    uint8_t channel = 0;        /*Channel index*/
+
+    start_channels(spread_mode, 50u, channels);
+
+    for (channel = 0; channel < channels; channel++)
+    {
+        Driver_PWM_set_duty(0, channel, duty + (10u * channel));
+    }
+
+    run_periods(last + 1u);
+
+    for (period = first; period < last; period++)
+    {
+        length = (uint32_t)(period_starts[period + 1u] - period_starts[period]);
+        shortest = (length < shortest) ? length : shortest;
+        longest = (length > longest) ? length : longest;
+        PIT_MODEL_CHECK((length >= (TEST_PERIOD - spread_counts)) && (length <= (TEST_PERIOD + spread_counts)));
+
+        drift = (int64_t)(period_starts[period + 1u] - period_starts[first]) -
+                ((int64_t)(period + 1u - first) * TEST_PERIOD);
+
+        if (PWM_SPREAD_OFF == spread_mode)
+        {
+            PIT_MODEL_CHECK(TEST_PERIOD == length);
+        }
+        else if (PWM_SPREAD_TRIANGLE == spread_mode)
+        {
+            PIT_MODEL_CHECK(((period + 1u - first) < TEST_CYCLE) ||
+                            ((period_starts[period + 1u] - period_starts[period + 1u - TEST_CYCLE]) ==
+                             ((uint64_t)TEST_CYCLE * TEST_PERIOD)));
+        }
+        else
+        {
+            PIT_MODEL_CHECK(llabs(drift) <= (int64_t)((PWM_SPREAD_STEPS + 1u) * spread_counts));
+        }
+    }
+
+    /*The spread modes use a good part of their range*/
+    PIT_MODEL_CHECK((PWM_SPREAD_OFF == spread_mode) || ((longest - shortest) >= spread_counts));
+
+    tolerance = (PWM_SPREAD_RANDOM == spread_mode) ? 0.001 : (2.0 / TEST_PERIOD);
+
+    for (channel = 0; channel < channels; channel++)
+    {
+        measured = (double)(on_at_start[last][channel] - on_at_start[first][channel]) /
+                   (double)(period_starts[last] - period_starts[first]);
+        PIT_MODEL_CHECK(((measured - ((double)(duty + (10u * channel)) / TEST_RESOLUTION)) <= tolerance) &&
+                        ((((double)(duty + (10u * channel)) / TEST_RESOLUTION) - measured) <= tolerance));
+    }
+
+    printf("spread %u, %u channels: period %u..%u, drift %lld counts\n", (unsigned int)spread_mode,
+           (unsigned int)channels, (unsigned int)shortest, (unsigned int)longest, (long long)drift);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_changing_limit
+* Description: Eight channels with a 10 % spread switch between 50 % and 56 %
+*              every half triangle cycle, so the spread limit moves in step
+*              with the triangle. The period starts stay within half a cycle
+*              of spread of their nominal time for the triangle, and within
+*              two random ranges for the random mode.
+*
+END***************************************************************************/
+static void test_changing_limit(PWM_spread_enum_t spread_mode)
+{
+    uint32_t spread_counts = (TEST_PERIOD * 100u) / 1000u; /*Highest period change*/
+    uint32_t period = 0;        /*Period index*/
+    uint32_t last = TEST_MAX_PERIODS - 1u;  /*Last period start checked*/
+    int64_t drift = 0;          /*Time of a period start minus its nominal time*/
+    int64_t largest = 0;        /*Largest drift*/
+    uint8_t channel = 0;        /*Channel index*/
+
+    start_channels(spread_mode, 100u, PWM_MAX_CHANNELS);
+
+    while (period_count < TEST_MAX_PERIODS)
+    {
+        for (channel = 0; channel < PWM_MAX_CHANNELS; channel++)
+        {
+            Driver_PWM_set_duty(0, channel, (0 == ((period_count / PWM_SPREAD_STEPS) & 1u)) ? 50u : 56u);
+        }
+
+        run_periods(period_count + 1u);
+    }
+
+    for (period = TEST_SETTLE_PERIODS; period <= last; period++)
+    {
+        drift = (int64_t)(period_starts[period] - period_starts[TEST_SETTLE_PERIODS]) -
+                ((int64_t)(period - TEST_SETTLE_PERIODS) * TEST_PERIOD);
+        largest = (llabs(drift) > largest) ? llabs(drift) : largest;
+    }
+
+    if (PWM_SPREAD_TRIANGLE == spread_mode)
+    {
+        PIT_MODEL_CHECK(largest <= (int64_t)((PWM_SPREAD_STEPS / 2u) * spread_counts));
+    }
+    else
+    {
+        PIT_MODEL_CHECK(largest <= (int64_t)(2u * (PWM_SPREAD_STEPS + 1u) * spread_counts));
+    }
+
+    printf("spread %u, changing limit: average period %.3f counts, largest drift %lld counts\n",
+           (unsigned int)spread_mode,
+           (double)(period_starts[last] - period_starts[TEST_SETTLE_PERIODS]) / (last - TEST_SETTLE_PERIODS),
+           (long long)largest);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: harmonic_energy
+* Description: Each pulse adds the integral of exp(-j w t) from its start to
+*              its end, so the transform of the pin is exact
+*
+END***************************************************************************/
+static double harmonic_energy(uint32_t first, uint32_t last, uint32_t harmonic)
+{
+    double omega = (2.0 * TEST_PI * harmonic) / TEST_PERIOD;   /*Angular frequency per PIT count*/
+    double real = 0;        /*Real part of the transform*/
+    double imaginary = 0;   /*Imaginary part of the transform*/
+    double start = 0;       /*Pulse start from the window start*/
+    double end = 0;         /*Pulse end from the window start*/
+    uint32_t pulse = 0;     /*Pulse index*/
+
+    for (pulse = first; pulse < last; pulse++)
+    {
+        start = (double)(period_starts[pulse] - period_starts[first]);
+        end = (double)(pulse_ends[pulse] - period_starts[first]);
+        real += sin(omega * end) - sin(omega * start);
+        imaginary += cos(omega * end) - cos(omega * start);
+    }
+
+    return ((real * real) + (imaginary * imaginary)) / (omega * omega);
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_spectrum
+* Description: Without spread, the pin is periodic and its energy sits on
+*              the lines of the PWM frequency. The triangle and random
+*              periods move it between the lines, so every line of the first
+*              harmonics drops by at least 10 dB in a window of 40 triangle
+*              cycles.
+*
+END***************************************************************************/
+static void test_spectrum(void)
+{
+    uint32_t first = TEST_SETTLE_PERIODS;   /*First pulse of the window*/
+    uint32_t last = TEST_SETTLE_PERIODS + (40u * TEST_CYCLE);  /*Pulse after the window*/
+    double fixed_energy[TEST_HARMONICS];    /*Energy of each line without spread*/
+    double drop = 0;        /*Drop of a line with spread in dB*/
+    uint32_t harmonic = 0;  /*Harmonic number*/
+    uint8_t spread_mode = 0;    /*Spread mode*/
+
+    for (spread_mode = PWM_SPREAD_OFF; spread_mode <= PWM_SPREAD_RANDOM; spread_mode++)
+    {
+        start_channels((PWM_spread_enum_t)spread_mode, 50u, 1u);
+        Driver_PWM_set_duty(0, 0, 30u);
+        run_periods(last + 1u);
+        printf("spread %u spectrum:", (unsigned int)spread_mode);
+
+        for (harmonic = 1; harmonic <= TEST_HARMONICS; harmonic++)
+        {
+            if (PWM_SPREAD_OFF == spread_mode)
+            {
+                fixed_energy[harmonic - 1u] = harmonic_energy(first, last, harmonic);
+                printf(" %.1f dB", 10.0 * log10(fixed_energy[harmonic - 1u]));
+            }
+            else
+            {
+                drop = 10.0 * log10(fixed_energy[harmonic - 1u] / harmonic_energy(first, last, harmonic));
+                PIT_MODEL_CHECK(drop >= 10.0);
+                printf(" -%.1f dB", drop);
+            }
+        }
+
+        printf("\n");
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    uint8_t spread_mode = 0;    /*Spread mode*/
+
+    for (spread_mode = PWM_SPREAD_OFF; spread_mode <= PWM_SPREAD_RANDOM; spread_mode++)
+    {
+        test_fixed_duty((PWM_spread_enum_t)spread_mode, 1u, 30u);
+        test_fixed_duty((PWM_spread_enum_t)spread_mode, 3u, 47u);
+    }
+
+    test_changing_limit(PWM_SPREAD_TRIANGLE);
+    test_changing_limit(PWM_SPREAD_RANDOM);
+    test_spectrum();
+
+    printf("test_PWM_spread: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
@@ -0,0 +1,280 @@
+/**
+ * @file  : test_TASK_scheduler.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the run order, the rate limit and the periodic events of the task scheduler on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_TIMER.h"
+#include "../Includes/Driver/Driver_TASK.h"
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_TIMER_INDEX (1u)       /*PIT timer of the software timers*/
+#define TEST_TICK_COUNTS (10486u)   /*About 1 ms at the bus clock*/
+#define TEST_LOG_LENGTH (64u)       /*Task runs recorded*/
+#define TEST_TASK_COUNT (3u)        /*Tasks created*/
+#define TEST_RUN_TICKS (50u)        /*Ticks the scheduler runs for in the rate limit test*/
+#define TEST_LIMIT_TICKS (5u)       /*Rate limit of the task posted every tick*/
+#define TEST_PERIOD_TICKS (10u)     /*Period of the periodic task*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Run of a task
+ */
+typedef struct test_run
+{
+    uint8_t priority;   /*Priority of the task*/
+    uint32_t events;    /*Events given to the task*/
+    uint64_t time;      /*Model time of the run*/
+} test_run_info;
+
+/*******************************************************************************
+ * Variable
+ ******************************************************************************/
+
+static const uint8_t priorities[TEST_TASK_COUNT] = {0u, 1u, 2u};   /*Context of each task*/
+static test_run_info runs[TEST_LOG_LENGTH];                         /*Runs recorded*/
+static uint32_t run_count = 0;                                      /*Number of runs recorded*/
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Record a run of a task
+ *
+ * @param context is the priority of the task
+ * @param events is the events given to the task
+ *
+ * @return: this function return nothing.
+ */
+static void record_run(void *context, uint32_t events);
+
+/**
+ * @brief Reset the model and the log, then init the software timers and create the tasks
+ *
+ * @param limit_ticks is the rate limit of the task of priority 0
+ *
+ * @return: this function return nothing.
+ */
+static void create_tasks(uint32_t limit_ticks);
+
+/**
+ * @brief Run the scheduler until the core sleeps past a time
+ *
+ * @param end_time is the model time at which the scheduler is left
+ *
+ * @return: this function return nothing.
+ */
+static void run_tasks(uint64_t end_time);
+
+/**
+ * @brief Check that the ready tasks run by priority with their events merged
+ *
+ * @return: this function return nothing.
+ */
+static void test_priority(void);
+
+/**
+ * @brief Check the runs of a rate limited task posted every tick and of a periodic task
+ *
+ * @return: this function return nothing.
+ */
+static void test_rate_limit(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: record_run
+* Description: Record a run of a task
+*
+END***************************************************************************/
+static void record_run(void *context, uint32_t events)
+{
+    if (run_count < TEST_LOG_LENGTH)
+    {
+        runs[run_count].priority = *(const uint8_t *)context;
+        runs[run_count].events = events;
+        runs[run_count].time = PIT_model_time;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    run_count++;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: create_tasks
+* Description: The tasks of a previous test are replaced
+*
+END***************************************************************************/
+static void create_tasks(uint32_t limit_ticks)
+{
+    TIMER_config_info timer_config = {
+        .timer_index = TEST_TIMER_INDEX,
+        .tick_counts = TEST_TICK_COUNTS,
+    };
+    TASK_config_info task_config = {
+        .task_func = record_run,
+    };
+    uint32_t index = 0; /*Task index*/
+
+    PIT_model_reset();
+    run_count = 0;
+    Driver_TIMER_init(&timer_config);
+
+    for (index = 0; index < TEST_TASK_COUNT; index++)
+    {
+        task_config.priority = priorities[index];
+        task_config.context = (void *)&priorities[index];
+        task_config.min_interval_ticks = (0 == index) ? limit_ticks : 0u;
+        Driver_TASK_create(&task_config);
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: run_tasks
+* Description: Driver_TASK_run never returns, the sleep of the model jumps
+*              back here
+*
+END***************************************************************************/
+static void run_tasks(uint64_t end_time)
+{
+    PIT_model_sleep_end = end_time;
+
+    if (0 == setjmp(PIT_model_sleep_exit))
+    {
+        Driver_TASK_run();
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_priority
+* Description: The tasks are posted from the lowest priority up, they run
+*              from the highest one down, then the core sleeps
+*
+END***************************************************************************/
+static void test_priority(void)
+{
+    create_tasks(0);
+    Driver_TASK_post(2u, 0x1u);
+    Driver_TASK_post(1u, 0x2u);
+    Driver_TASK_post(2u, 0x8u);
+    Driver_TASK_post(0u, 0x4u);
+    Driver_TASK_post(0u, 0);
+    run_tasks(PIT_model_time + TEST_TICK_COUNTS);
+
+    PIT_MODEL_CHECK(3u == run_count);
+    PIT_MODEL_CHECK((0u == runs[0].priority) && (0x4u == runs[0].events));
+    PIT_MODEL_CHECK((1u == runs[1].priority) && (0x2u == runs[1].events));
+    PIT_MODEL_CHECK((2u == runs[2].priority) && (0x9u == runs[2].events));
+    PIT_MODEL_CHECK(1u == PIT_model_sleeps);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_rate_limit
+* Description: The task of priority 0 is posted every tick and runs every
+*              TEST_LIMIT_TICKS ticks with the events posted meanwhile. The
+*              task of priority 2 runs once per period.
+*
+END***************************************************************************/
+static void test_rate_limit(void)
+{
+    uint64_t start = 0;         /*Model time of the start*/
+    uint32_t run = 0;           /*Run index*/
+    uint32_t limited_runs = 0;  /*Runs of the rate limited task*/
+    uint32_t periodic_runs = 0; /*Runs of the periodic task*/
+    uint64_t last = 0;          /*Time of the previous run of the rate limited task*/
+
+    create_tasks(TEST_LIMIT_TICKS);
+    start = PIT_model_time;
+    Driver_TASK_start_periodic(0u, 0x1u, 1u);
+    Driver_TASK_start_periodic(2u, 0x2u, TEST_PERIOD_TICKS);
+    run_tasks(start + (TEST_RUN_TICKS * TEST_TICK_COUNTS) + (TEST_TICK_COUNTS / 2u));
+
+    for (run = 0; (run < run_count) && (run < TEST_LOG_LENGTH); run++)
+    {
+        if (0u == runs[run].priority)
+        {
+            PIT_MODEL_CHECK(0x1u == runs[run].events);
+            PIT_MODEL_CHECK((0 == limited_runs) ||
+                            ((runs[run].time - last) >= ((uint64_t)TEST_LIMIT_TICKS * TEST_TICK_COUNTS)));
+            PIT_MODEL_CHECK((0 == limited_runs) ||
+                            ((runs[run].time - last) < ((uint64_t)(TEST_LIMIT_TICKS + 1u) * TEST_TICK_COUNTS)));
+            last = runs[run].time;
+            limited_runs++;
+        }
+        else if (2u == runs[run].priority)
+        {
+            PIT_MODEL_CHECK(0x2u == runs[run].events);
+            periodic_runs++;
+        }
+        else
+        {
+            PIT_MODEL_CHECK(0);
+        }
+    }
+
+    /*Ticks 1, 6, ... 46 for the limited task, 10, 20, ... 50 for the periodic one*/
+    PIT_MODEL_CHECK((TEST_RUN_TICKS / TEST_LIMIT_TICKS) == limited_runs);
+    PIT_MODEL_CHECK((TEST_RUN_TICKS / TEST_PERIOD_TICKS) == periodic_runs);
+    PIT_MODEL_CHECK(PIT_model_sleeps >= run_count);
+
+    printf("%u ticks: %u runs of the task limited to one per %u ticks, %u periodic runs, %u interrupts\n",
+           (unsigned int)TEST_RUN_TICKS, (unsigned int)limited_runs, (unsigned int)TEST_LIMIT_TICKS,
+           (unsigned int)periodic_runs, (unsigned int)PIT_model_interrupts);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_priority();
+    test_rate_limit();
+
+    printf("test_TASK_scheduler: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/
@@ -0,0 +1,229 @@
+/**
+ * @file  : test_TIMER_wheel.c
+ * @author: Nguyen The Anh.
+ * @brief : Check the expiry times and the interrupts of the software timer wheel on the PIT model.
+ * @version: 0.0
+ *
+ * @copyright Copyright (c) 2024.
+ *
+ */
+
+/*******************************************************************************
+ * Include
+ ******************************************************************************/
+
+#include "PIT_model.h"
+#include "../Includes/Driver/Driver_TIMER.h"
+
+/*******************************************************************************
+ * Macro
+ ******************************************************************************/
+
+#define TEST_TIMER_INDEX (1u)           /*PIT timer of the service*/
+#define TEST_TICK_COUNTS (10486u)       /*About 1 ms at the bus clock*/
+#define TEST_TIMER_COUNT (5u)           /*One-shot timers started together*/
+#define TEST_PERIOD_TICKS (7u)          /*Period of the periodic timer*/
+#define TEST_PERIODS (20u)              /*Expiries of the periodic timer checked*/
+#define TEST_SLACK_COUNTS (8u)          /*Register reads of a start, one count each on the model*/
+#define TEST_RESTART_COUNTS (1u)        /*Counts from the read of the counter to the restart of the PIT*/
+
+/*******************************************************************************
+ * Struct
+ ******************************************************************************/
+
+/**
+ * @brief Expiries seen by the callback of a timer
+ */
+typedef struct test_expiry
+{
+    uint64_t times[TEST_PERIODS];   /*Model time of each expiry*/
+    uint32_t count;                 /*Number of expiries*/
+} test_expiry_info;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Record the time of an expiry
+ *
+ * @param context is the test_expiry_info of the timer
+ *
+ * @return: this function return nothing.
+ */
+static void record_expiry(void *context);
+
+/**
+ * @brief Init the timer service on a reset model
+ *
+ * @return: this function return nothing.
+ */
+static void start_service(void);
+
+/**
+ * @brief Check the expiry times of one-shot timers inside and past one turn of the wheel
+ *
+ * @return: this function return nothing.
+ */
+static void test_one_shot(void);
+
+/**
+ * @brief Check that a periodic timer does not drift and that a stopped timer does not expire
+ *
+ * @return: this function return nothing.
+ */
+static void test_periodic(void);
+
+/*******************************************************************************
+ * Functions
+ ******************************************************************************/
+
+/*Functions*********************************************************************
+*
+* Function name: record_expiry
+* Description: Record the time of an expiry
+*
+END***************************************************************************/
+static void record_expiry(void *context)
+{
+    test_expiry_info *expiry = (test_expiry_info *)context;    /*Expiries of the timer*/
+
+    if (expiry->count < TEST_PERIODS)
+    {
+        expiry->times[expiry->count] = PIT_model_time;
+    }
+    else
+    {
+        /*Do nothing*/
+    }
+
+    expiry->count++;
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: start_service
+* Description: Init the timer service on a reset model
+*
+END***************************************************************************/
+static void start_service(void)
+{
+    TIMER_config_info config = {
+        .timer_index = TEST_TIMER_INDEX,
+        .tick_counts = TEST_TICK_COUNTS,
+    };
+
+    PIT_model_reset();
+    Driver_TIMER_init(&config);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_one_shot
+* Description: The PIT starts with the first timer, so each expiry is a
+*              whole number of ticks after it. A timer past the wheel costs
+*              one interrupt per turn, an idle wheel none.
+*
+END***************************************************************************/
+static void test_one_shot(void)
+{
+    static const uint32_t delays[TEST_TIMER_COUNT] = {1u, 5u, 31u, 32u, 100u};   /*Delay of each timer*/
+    TIMER_info timers[TEST_TIMER_COUNT] = {0};          /*Timers started together*/
+    test_expiry_info expiries[TEST_TIMER_COUNT] = {0};  /*Expiries of each timer*/
+    uint64_t start = 0;     /*Model time of the first start*/
+    uint64_t expected = 0;  /*Time of the expiry from the first start*/
+    uint32_t index = 0;     /*Timer index*/
+
+    start_service();
+    start = PIT_model_time;
+
+    for (index = 0; index < TEST_TIMER_COUNT; index++)
+    {
+        Driver_TIMER_start(&timers[index], delays[index], 0, record_expiry, &expiries[index]);
+        PIT_MODEL_CHECK(1 == Driver_TIMER_is_running(&timers[index]));
+    }
+
+    PIT_model_run_until(start + (((uint64_t)delays[TEST_TIMER_COUNT - 1u] + 10u) * TEST_TICK_COUNTS));
+
+    for (index = 0; index < TEST_TIMER_COUNT; index++)
+    {
+        expected = start + ((uint64_t)delays[index] * TEST_TICK_COUNTS);
+        PIT_MODEL_CHECK(1 == expiries[index].count);
+        PIT_MODEL_CHECK(0 == Driver_TIMER_is_running(&timers[index]));
+        PIT_MODEL_CHECK((expiries[index].times[0] >= expected) &&
+                        (expiries[index].times[0] <= (expected + TEST_SLACK_COUNTS)));
+    }
+
+    /*Ticks 1, 5, 31 and 32, and the slot of the 100 ticks timer at 4, 36, 68 and 100*/
+    PIT_MODEL_CHECK(8u == PIT_model_interrupts);
+    PIT_MODEL_CHECK(100u == Driver_TIMER_read_ticks());
+
+    printf("One-shot timers at 1, 5, 31, 32 and 100 ticks: %u interrupts\n", (unsigned int)PIT_model_interrupts);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: test_periodic
+* Description: The next expiry of a periodic timer is counted from the
+*              previous one, not from its callback. The interrupt restarts
+*              the PIT one register access after it reads the counter, each
+*              interval is that much longer on the model.
+*
+END***************************************************************************/
+static void test_periodic(void)
+{
+    TIMER_info periodic = {0};              /*Periodic timer*/
+    TIMER_info stopped = {0};               /*Timer stopped before its expiry*/
+    test_expiry_info periodic_expiries = {0};   /*Expiries of the periodic timer*/
+    test_expiry_info stopped_expiries = {0};    /*Expiries of the stopped timer*/
+    uint32_t index = 0;     /*Expiry index*/
+
+    start_service();
+    Driver_TIMER_start(&periodic, TEST_PERIOD_TICKS, TEST_PERIOD_TICKS, record_expiry, &periodic_expiries);
+    Driver_TIMER_start(&stopped, 3u, 0, record_expiry, &stopped_expiries);
+    PIT_model_run_until(PIT_model_time + TEST_TICK_COUNTS);
+    Driver_TIMER_stop(&stopped);
+
+    PIT_model_run_until(PIT_model_time + (((uint64_t)TEST_PERIODS * TEST_PERIOD_TICKS) * TEST_TICK_COUNTS));
+    PIT_MODEL_CHECK(0 == stopped_expiries.count);
+    PIT_MODEL_CHECK(TEST_PERIODS == periodic_expiries.count);
+
+    for (index = 1; index < TEST_PERIODS; index++)
+    {
+        PIT_MODEL_CHECK((((uint64_t)TEST_PERIOD_TICKS * TEST_TICK_COUNTS) + TEST_RESTART_COUNTS) ==
+                        (periodic_expiries.times[index] - periodic_expiries.times[index - 1u]));
+    }
+
+    /*Once stopped, the PIT stops and the wheel costs no interrupt*/
+    Driver_TIMER_stop(&periodic);
+    PIT_model_run_until(PIT_model_time + (2u * TEST_PERIOD_TICKS * TEST_TICK_COUNTS));
+    PIT_model_interrupts = 0;
+    PIT_model_run_until(PIT_model_time + (100u * TEST_TICK_COUNTS));
+    PIT_MODEL_CHECK(0 == PIT_model_interrupts);
+    PIT_MODEL_CHECK(TEST_PERIODS == periodic_expiries.count);
+
+    return;
+}
+
+/*Functions*********************************************************************
+*
+* Function name: main
+* Description: Run the checks, the exit code is the number of failed checks
+*
+END***************************************************************************/
+int main(void)
+{
+    test_one_shot();
+    test_periodic();
+
+    printf("test_TIMER_wheel: %u failed checks\n", (unsigned int)PIT_model_failures);
+
+    return (0 == PIT_model_failures) ? 0 : 1;
+}
+/*EOF*/